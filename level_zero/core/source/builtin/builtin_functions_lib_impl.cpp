@@ -14,6 +14,8 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <thread>
+
 namespace NEO {
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) {
     return nullptr;
@@ -182,11 +184,23 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
 }
 
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
-    if (initBuiltinsAsyncEnabled(device)) {
+    bool prewarmBuiltins = false;
+    bool asyncInit = initBuiltinsAsyncEnabled(device);
+    if (NEO::debugManager.flags.PrewarmBuiltinKernels.get() != -1) {
+        prewarmBuiltins = NEO::debugManager.flags.PrewarmBuiltinKernels.get() == 1;
+        asyncInit = prewarmBuiltins;
+    }
+
+    if (asyncInit) {
         this->initAsyncComplete = false;
 
-        auto initFunc = [this]() {
+        auto initFunc = [this, prewarmBuiltins]() {
             this->initBuiltinKernel(Builtin::fillBufferImmediate);
+            if (prewarmBuiltins) {
+                for (auto builtin : prewarmedBuiltins) {
+                    this->initBuiltinKernel(builtin);
+                }
+            }
             this->initAsync.store(true);
         };
 
@@ -277,6 +291,7 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 void BuiltinFunctionsLibImpl::ensureInitCompletion() {
     if (!this->initAsyncComplete) {
         while (!this->initAsync.load()) {
+            std::this_thread::yield();
         }
         this->initAsyncComplete = true;
     }
@@ -27,6 +27,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     struct BuiltinData;
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib);
     ~BuiltinFunctionsLibImpl() override {
+        ensureInitCompletion();
         builtins->reset();
         imageBuiltins->reset();
     }
@@ -40,6 +41,16 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
 
     static bool initBuiltinsAsyncEnabled(Device *device);
 
+    // built in the background together with fillBufferImmediate when PrewarmBuiltinKernels is set,
+    // modules are shared so only copyBufferToBuffer and fillBuffer programs are compiled
+    static constexpr Builtin prewarmedBuiltins[] = {
+        Builtin::copyBufferBytes,
+        Builtin::copyBufferToBufferMiddle,
+        Builtin::copyBufferToBufferSide,
+        Builtin::fillBufferImmediateLeftOver,
+        Builtin::fillBufferMiddle,
+        Builtin::fillBufferRightLeftover};
+
   protected:
     std::vector<std::unique_ptr<Module>> modules = {};
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::count)];
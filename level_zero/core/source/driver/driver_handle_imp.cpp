@@ -261,6 +261,10 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
         createHostPointerManager();
     }
 
+    if (NEO::debugManager.flags.EnableCounterWaitService.get() == 1) {
+        counterWaitService = std::make_unique<NEO::CounterWaitService>();
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/debugger/debugger.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/os_interface/os_library.h"
+#include "shared/source/utilities/counter_wait_service.h"
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -126,6 +127,7 @@ struct DriverHandleImp : public DriverHandle {
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<NEO::CounterWaitService> counterWaitService;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
@@ -11,6 +11,10 @@
 
 #include "level_zero/core/source/event/event.h"
 
+namespace NEO {
+class CounterWaitService;
+}
+
 namespace L0 {
 
 template <typename TagSizeT>
@@ -56,6 +60,7 @@ struct EventImp : public Event {
 
   protected:
     ze_result_t waitForUserFence(uint64_t timeout);
+    ze_result_t waitForCounterWaitService(NEO::CounterWaitService &counterWaitService, std::chrono::microseconds maxWaitTime);
 
     bool handlePreQueryStatusOperationsAndCheckCompletion();
 
@@ -15,9 +15,11 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_time.h"
+#include "shared/source/utilities/counter_wait_service.h"
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
@@ -509,6 +511,27 @@ ze_result_t EventImp<TagSizeT>::waitForUserFence(uint64_t timeout) {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::waitForCounterWaitService(NEO::CounterWaitService &counterWaitService, std::chrono::microseconds maxWaitTime) {
+    if (handlePreQueryStatusOperationsAndCheckCompletion()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (inOrderExecInfo) {
+        const uint64_t *hostAddress = ptrOffset(inOrderExecInfo->getBaseHostAddress(), this->inOrderAllocationOffset);
+        auto waitValue = getInOrderExecSignalValueWithSubmissionCounter();
+
+        for (uint32_t i = 0; i < inOrderExecInfo->getNumHostPartitionsToWait(); i++) {
+            if (!counterWaitService.waitForValue(hostAddress, waitValue, maxWaitTime)) {
+                break;
+            }
+            hostAddress = ptrOffset(hostAddress, sizeof(uint64_t));
+        }
+    }
+
+    return queryStatus();
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
     std::chrono::microseconds elapsedTimeSinceGpuHangCheck{0};
@@ -525,11 +548,22 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
     }
 
+    NEO::CounterWaitService *counterWaitService = nullptr;
+    if (timeout != 0 && (isCounterBased() || this->inOrderExecInfo.get())) {
+        counterWaitService = static_cast<DriverHandleImp *>(device->getDriverHandle())->counterWaitService.get();
+    }
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     do {
         if (isKmdWaitModeEnabled() && isCounterBased()) {
             ret = waitForUserFence(timeout);
+        } else if (counterWaitService) {
+            auto maxWaitTime = this->gpuHangCheckPeriod;
+            if (timeout != std::numeric_limits<uint64_t>::max()) {
+                maxWaitTime = std::min(maxWaitTime, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(timeout - timeDiff)));
+            }
+            ret = waitForCounterWaitService(*counterWaitService, maxWaitTime);
         } else {
             ret = queryStatus();
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,16 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t size, void *device) {
+    UNRECOVERABLE_IF(true);
+}
+void PageFaultManager::releaseCleanRange(void *ptr, size_t size, void *device) {
+    UNRECOVERABLE_IF(true);
+}
+bool PageFaultManager::isChunkedMigrationSupported() {
+    // page fault copies always transfer whole allocation
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
 
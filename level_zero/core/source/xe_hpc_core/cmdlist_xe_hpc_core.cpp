@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,7 +33,11 @@ ze_result_t CommandListCoreFamily<IGFX_XE_HPC_CORE>::appendMemoryPrefetch(const
         this->performMemoryPrefetch = true;
         auto prefetchManager = device->getDriverHandle()->getMemoryManager()->getPrefetchManager();
         if (prefetchManager) {
-            prefetchManager->insertAllocation(this->prefetchContext, ptr, *allocData);
+            if (NEO::debugManager.flags.EnableAsyncMemoryPrefetch.get() && this->isImmediateType() && this->getCsr()) {
+                prefetchManager->insertAllocationAndPrefetchAsync(this->prefetchContext, ptr, *allocData, *svmAllocMgr, *device->getNEODevice(), *this->getCsr());
+            } else {
+                prefetchManager->insertAllocation(this->prefetchContext, ptr, *allocData);
+            }
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -150,6 +150,60 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrewarmBuiltinKernelsWhenCreateBuiltinFunctionsLibThenFirstCopyDoesNotLoadBuiltins) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+
+        std::unique_ptr<BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) override {
+            loadBuiltInCalled++;
+            return BuiltinFunctionsLibImpl::loadBuiltIn(builtin, builtInName);
+        }
+
+        std::atomic<uint32_t> loadBuiltInCalled = 0;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PrewarmBuiltinKernels.set(1);
+
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_FALSE(lib.initAsyncComplete);
+    lib.ensureInitCompletion();
+
+    EXPECT_NE(nullptr, lib.builtins[static_cast<uint32_t>(Builtin::fillBufferImmediate)]);
+    for (auto builtin : BuiltinFunctionsLibImpl::prewarmedBuiltins) {
+        EXPECT_NE(nullptr, lib.builtins[static_cast<uint32_t>(builtin)]);
+    }
+    auto loadBuiltInCalledAtCreation = lib.loadBuiltInCalled.load();
+
+    EXPECT_NE(nullptr, lib.getFunction(Builtin::copyBufferBytes));
+    EXPECT_NE(nullptr, lib.getFunction(Builtin::copyBufferToBufferMiddle));
+    EXPECT_NE(nullptr, lib.getFunction(Builtin::fillBufferMiddle));
+    EXPECT_EQ(loadBuiltInCalledAtCreation, lib.loadBuiltInCalled.load());
+
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenPrewarmBuiltinKernelsDisabledWhenCreateBuiltinFunctionsLibThenBuiltinsAreNotLoadedAsynchronously) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PrewarmBuiltinKernels.set(0);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_TRUE(lib.initAsyncComplete);
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        EXPECT_EQ(nullptr, lib.builtins[builtId]);
+    }
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceAndImageSupportedThenBuiltinsImageFunctionsAreLoaded) {
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterfaceSpirv());
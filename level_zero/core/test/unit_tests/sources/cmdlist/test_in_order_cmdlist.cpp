@@ -341,6 +341,44 @@ HWTEST2_F(InOrderCmdListTests, givenDebugFlagSetWhenEventHostSyncCalledThenCallW
     EXPECT_EQ(2u, ultCsr->waitUserFenecParams.callCount);
 }
 
+HWTEST2_F(InOrderCmdListTests, givenCounterWaitServiceWhenEventHostSyncCalledThenWaitThroughService, IsAtLeastSkl) {
+    struct MockCounterWaitService : public NEO::CounterWaitService {
+        bool waitForValue(volatile const uint64_t *address, uint64_t targetValue, std::chrono::microseconds timeout) override {
+            waitForValueCalled++;
+            latestWaitedAddress = address;
+            return CounterWaitService::waitForValue(address, targetValue, timeout);
+        }
+
+        uint32_t waitForValueCalled = 0;
+        volatile const uint64_t *latestWaitedAddress = nullptr;
+    };
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto eventPool = createEvents<FamilyType>(1, false);
+
+    auto counterWaitService = new MockCounterWaitService();
+    static_cast<DriverHandleImp *>(device->getDriverHandle())->counterWaitService.reset(counterWaitService);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    auto hostAddress = static_cast<uint64_t *>(ptrOffset(events[0]->inOrderExecInfo->getBaseHostAddress(), events[0]->inOrderAllocationOffset));
+    *hostAddress = 0;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->hostSynchronize(2));
+    EXPECT_NE(0u, counterWaitService->waitForValueCalled);
+    EXPECT_EQ(hostAddress, counterWaitService->latestWaitedAddress);
+
+    auto waitForValueCalled = counterWaitService->waitForValueCalled;
+    *hostAddress = std::numeric_limits<uint64_t>::max();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(waitForValueCalled + 1, counterWaitService->waitForValueCalled);
+
+    // already completed
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(waitForValueCalled + 1, counterWaitService->waitForValueCalled);
+}
+
 HWTEST2_F(InOrderCmdListTests, givenInOrderModeWhenHostResetOrSignalEventCalledThenReturnError, IsAtLeastSkl) {
     auto immCmdList = createImmCmdList<gfxCoreFamily>();
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "test_api_tracing_common.h"
+
+#include <sstream>
+
+namespace L0 {
+namespace ult {
+
+TEST_F(ZeApiTracingRuntimeTests, GivenBinaryTracerWhenCallingTracingWrapperThenBinaryRecordIsStoredForEachCall) {
+    driverDdiTable.coreDdiTable.CommandList.pfnAppendBarrier =
+        [](ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent,
+           uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) -> ze_result_t { return ZE_RESULT_ERROR_INVALID_ARGUMENT; };
+
+    prologCbs.CommandList.pfnAppendBarrierCb = genericPrologCallbackPtr;
+    epilogCbs.CommandList.pfnAppendBarrierCb = genericEpilogCallbackPtr;
+    setTracerCallbacksAndEnableTracer();
+
+    std::stringstream traceStream;
+    auto binaryTracer = std::make_unique<NEO::ApiBinaryTracer>(traceStream);
+    VariableBackup<NEO::ApiBinaryTracer *> binaryTracerBackup(&pGlobalBinaryTracer, binaryTracer.get());
+
+    auto hCommandList = reinterpret_cast<ze_command_list_handle_t>(0x1234);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListAppendBarrierTracing(hCommandList, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListAppendBarrierTracing(hCommandList, nullptr, 0, nullptr));
+    EXPECT_EQ(defaultUserData, 2);
+
+    binaryTracer.reset();
+
+    auto trace = traceStream.str();
+    ASSERT_EQ(sizeof(NEO::ApiBinaryTraceFileHeader) + 2 * sizeof(NEO::ApiBinaryTraceRecord), trace.size());
+
+    NEO::ApiBinaryTraceFileHeader header = {};
+    memcpy_s(&header, sizeof(header), trace.data(), sizeof(header));
+    EXPECT_EQ(NEO::ApiBinaryTraceFileHeader::magicValue, header.magic);
+    EXPECT_EQ(NEO::ApiBinaryTraceFileHeader::currentVersion, header.version);
+    EXPECT_EQ(sizeof(NEO::ApiBinaryTraceRecord), header.recordSize);
+
+    NEO::ApiBinaryTraceRecord records[2] = {};
+    memcpy_s(records, sizeof(records), trace.data() + sizeof(header), sizeof(records));
+    for (auto &record : records) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(driverDdiTable.coreDdiTable.CommandList.pfnAppendBarrier), record.apiId);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(hCommandList), record.handle);
+        EXPECT_EQ(static_cast<int32_t>(ZE_RESULT_ERROR_INVALID_ARGUMENT), record.result);
+        EXPECT_LE(record.startTimestamp, record.endTimestamp);
+        EXPECT_EQ(records[0].threadId, record.threadId);
+    }
+    EXPECT_EQ(records[0].correlationId + 1, records[1].correlationId);
+    EXPECT_LE(records[0].endTimestamp, records[1].startTimestamp);
+}
+
+TEST_F(ZeApiTracingRuntimeTests, GivenBinaryTracerWhenCallingTracingWrapperMoreTimesThanThreadBufferCapacityThenAllRecordsAreStored) {
+    driverDdiTable.coreDdiTable.CommandList.pfnAppendBarrier =
+        [](ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent,
+           uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) -> ze_result_t { return ZE_RESULT_SUCCESS; };
+
+    std::stringstream traceStream;
+    auto binaryTracer = std::make_unique<NEO::ApiBinaryTracer>(traceStream);
+    VariableBackup<NEO::ApiBinaryTracer *> binaryTracerBackup(&pGlobalBinaryTracer, binaryTracer.get());
+
+    const size_t callCount = NEO::ApiBinaryTracer::recordsPerThreadBuffer * 2 + 1;
+    for (size_t i = 0; i < callCount; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrierTracing(nullptr, nullptr, 0, nullptr));
+    }
+
+    binaryTracer.reset();
+
+    auto trace = traceStream.str();
+    ASSERT_EQ(sizeof(NEO::ApiBinaryTraceFileHeader) + callCount * sizeof(NEO::ApiBinaryTraceRecord), trace.size());
+
+    NEO::ApiBinaryTraceRecord firstRecord = {};
+    NEO::ApiBinaryTraceRecord lastRecord = {};
+    memcpy_s(&firstRecord, sizeof(firstRecord), trace.data() + sizeof(NEO::ApiBinaryTraceFileHeader), sizeof(firstRecord));
+    memcpy_s(&lastRecord, sizeof(lastRecord), trace.data() + trace.size() - sizeof(lastRecord), sizeof(lastRecord));
+    EXPECT_EQ(firstRecord.correlationId + callCount - 1, lastRecord.correlationId);
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/experimental/source/tracing/tracing_binary_imp.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <mutex>
+
+namespace L0 {
+
+NEO::ApiBinaryTracer *pGlobalBinaryTracer = nullptr;
+
+struct GlobalBinaryTracer {
+    ~GlobalBinaryTracer() {
+        pGlobalBinaryTracer = nullptr;
+        tracer.reset();
+    }
+    std::unique_ptr<NEO::ApiBinaryTracer> tracer;
+} globalBinaryTracer;
+
+NEO::ApiBinaryTracer *getBinaryTracer() {
+    static std::once_flag initializeOnce;
+    std::call_once(initializeOnce, []() {
+        auto fileName = NEO::debugManager.flags.ZeApiBinaryTraceFile.get();
+        if (fileName != "unk") {
+            globalBinaryTracer.tracer = NEO::ApiBinaryTracer::create(fileName);
+            pGlobalBinaryTracer = globalBinaryTracer.tracer.get();
+        }
+    });
+    return pGlobalBinaryTracer;
+}
+
+} // namespace L0
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/api_binary_tracer.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace L0 {
+
+// Binary trace of traced API calls, enabled with ZeApiBinaryTraceFile. Works independently of tracers
+// registered with zetTracerExpCreate, calls are identified by the address of the called DDI function.
+NEO::ApiBinaryTracer *getBinaryTracer();
+extern NEO::ApiBinaryTracer *pGlobalBinaryTracer;
+
+template <typename T, typename... Rest>
+uint64_t getBinaryTraceHandle(T &&first, Rest &&...) {
+    if constexpr (std::is_pointer_v<std::decay_t<T>>) {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(first));
+    } else {
+        return 0;
+    }
+}
+
+inline uint64_t getBinaryTraceHandle() {
+    return 0;
+}
+
+} // namespace L0
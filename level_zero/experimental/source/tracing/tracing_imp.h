@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
+#include "level_zero/experimental/source/tracing/tracing_binary_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdqueue_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_copy_imp.h"
@@ -200,7 +201,13 @@ ze_result_t apiTracerWrapperImp(TFunctionPointer zeApiPtr,
         if (callbacksPrologs->at(i).currentApiCallback != nullptr)
             callbacksPrologs->at(i).currentApiCallback(paramsStruct, ret, callbacksPrologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
     }
+    auto binaryTracer = getBinaryTracer();
+    const uint64_t startTimestamp = binaryTracer ? NEO::ApiBinaryTracer::getTimestamp() : 0;
     ret = zeApiPtr(args...);
+    if (binaryTracer) {
+        binaryTracer->record(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(zeApiPtr)), getBinaryTraceHandle(args...),
+                             startTimestamp, NEO::ApiBinaryTracer::getTimestamp(), static_cast<int32_t>(ret));
+    }
     std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
     for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
         if (callbacksEpilogs->at(i).currentApiCallback != nullptr)
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/linux/file_descriptor.h"
 
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
@@ -30,37 +31,85 @@ std::string PlatformMonitoringTech::getGuid() {
 }
 
 ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+    return readCounter(key, &value, sizeof(uint32_t));
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+    return readCounter(key, &value, sizeof(uint64_t));
+}
+
+ze_result_t PlatformMonitoringTech::readCounter(const std::string &key, void *value, size_t size) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+
+    if (NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.get() > 0) {
+        return readCounterFromSnapshot(offset->second, value, size);
+    }
+
     auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
     ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
+    if (this->preadFunction(fd, value, size, baseOffset + offset->second) != static_cast<ssize_t>(size)) {
         res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
     return res;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ze_result_t PlatformMonitoringTech::readCounterFromSnapshot(uint64_t keyOffset, void *value, size_t size) {
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+
+    auto now = std::chrono::steady_clock::now();
+    auto window = std::chrono::milliseconds(NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.get());
+    if (!snapshotValid || now - snapshotTimestamp >= window) {
+        auto result = refreshSnapshot();
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        snapshotTimestamp = now;
     }
-    auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
+
+    if (keyOffset < snapshotRegionOffset || keyOffset - snapshotRegionOffset + size > snapshot.size()) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
+    memcpy_s(value, size, snapshot.data() + (keyOffset - snapshotRegionOffset), size);
+    return ZE_RESULT_SUCCESS;
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+ze_result_t PlatformMonitoringTech::refreshSnapshot() {
+    snapshotValid = false;
+    if (keyOffsetMap.empty()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    return res;
+
+    if (!snapshotFd) {
+        auto fd = std::make_unique<NEO::FileDescriptor>(telemetryDeviceEntry.c_str(), O_RDONLY);
+        if (*fd == -1) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
+        snapshotFd = std::move(fd);
+    }
+
+    // width of the key at the highest offset is not known, region may end right after a 32-bit counter
+    auto minMaxOffsets = std::minmax_element(keyOffsetMap.begin(), keyOffsetMap.end(),
+                                             [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+    snapshotRegionOffset = minMaxOffsets.first->second;
+    auto lastKeyOffset = static_cast<size_t>(minMaxOffsets.second->second - snapshotRegionOffset);
+    snapshot.resize(lastKeyOffset + sizeof(uint64_t));
+
+    auto bytesRead = this->preadFunction(*snapshotFd, snapshot.data(), snapshot.size(), baseOffset + snapshotRegionOffset);
+    if (bytesRead < static_cast<ssize_t>(lastKeyOffset + sizeof(uint32_t))) {
+        snapshotFd.reset();
+        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    }
+    snapshot.resize(static_cast<size_t>(bytesRead));
+
+    snapshotValid = true;
+    return ZE_RESULT_SUCCESS;
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,16 +7,21 @@
 
 #pragma once
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/linux/file_descriptor.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "level_zero/zes_api.h"
 
 #include "igfxfmid.h"
 
+#include <chrono>
 #include <fcntl.h>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -45,8 +50,20 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_result_t init(FsAccessInterface *pFsAccess, const std::string &gpuUpstreamPortPath, PRODUCT_FAMILY productFamily);
     static void doInitPmtObject(FsAccessInterface *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
                                 std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject, PRODUCT_FAMILY productFamily);
+    ze_result_t readCounter(const std::string &key, void *value, size_t size);
+    ze_result_t readCounterFromSnapshot(uint64_t keyOffset, void *value, size_t size);
+    ze_result_t refreshSnapshot();
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
 
+    // Telemetry region spanning all known keys, read with a single pread and reused
+    // by all counter reads until it gets older than SysmanTelemetrySnapshotWindow
+    std::unique_ptr<NEO::FileDescriptor> snapshotFd;
+    std::vector<uint8_t> snapshot;
+    uint64_t snapshotRegionOffset = 0;
+    std::chrono::steady_clock::time_point snapshotTimestamp{};
+    bool snapshotValid = false;
+    std::mutex snapshotMutex;
+
   private:
     static const std::string baseTelemSysFS;
     static const std::string telem;
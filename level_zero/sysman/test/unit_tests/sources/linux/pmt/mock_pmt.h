@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -151,6 +151,10 @@ class PublicPlatformMonitoringTech : public L0::Sysman::PlatformMonitoringTech {
     using PlatformMonitoringTech::keyOffsetMap;
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::rootDeviceTelemNodeIndex;
+    using PlatformMonitoringTech::snapshot;
+    using PlatformMonitoringTech::snapshotRegionOffset;
+    using PlatformMonitoringTech::snapshotTimestamp;
+    using PlatformMonitoringTech::snapshotValid;
     using PlatformMonitoringTech::telemetryDeviceEntry;
 };
 
@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 
 #include "mock_pmt.h"
@@ -188,6 +190,141 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+uint32_t preadMockPmtSnapshotCalled = 0;
+size_t preadMockPmtSnapshotSize = 0;
+off_t preadMockPmtSnapshotOffset = 0;
+
+ssize_t preadMockPmtSnapshot(int fd, void *buf, size_t count, off_t offset) {
+    preadMockPmtSnapshotCalled++;
+    preadMockPmtSnapshotSize = count;
+    preadMockPmtSnapshotOffset = offset;
+    auto data = reinterpret_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < count; i++) {
+        data[i] = static_cast<uint8_t>(offset + i);
+    }
+    return count;
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWindowSetWhenReadingMultipleCountersThenTelemetryRegionIsReadOnceAndCountersAreServedFromSnapshot) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.set(100000);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    pPmt->preadFunction = preadMockPmtSnapshot;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x18}, {"KEY_C", 0x30}};
+    preadMockPmtSnapshotCalled = 0;
+
+    uint32_t valueA = 0;
+    uint64_t valueB = 0;
+    uint64_t valueC = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", valueA));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_B", valueB));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_C", valueC));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValue("UNKNOWN_KEY", valueC));
+
+    EXPECT_EQ(1u, preadMockPmtSnapshotCalled);
+    EXPECT_EQ(0x10, preadMockPmtSnapshotOffset);
+    EXPECT_EQ(0x28u, preadMockPmtSnapshotSize);
+    EXPECT_EQ(0x13121110u, valueA);
+    EXPECT_EQ(0x1f1e1d1c1b1a1918u, valueB);
+    EXPECT_EQ(0x3736353433323130u, valueC);
+
+    pPmt->snapshotTimestamp -= std::chrono::milliseconds(100000);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", valueA));
+    EXPECT_EQ(2u, preadMockPmtSnapshotCalled);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWindowSetAndPreadFailsWhenReadingCounterThenErrorIsReturnedAndSnapshotIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.set(100000);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    pPmt->preadFunction = preadMockPmtFailure;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+
+    uint32_t value = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", value));
+    EXPECT_FALSE(pPmt->snapshotValid);
+
+    pPmt->preadFunction = preadMockPmt;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", value));
+    EXPECT_TRUE(pPmt->snapshotValid);
+    EXPECT_EQ(3u, value);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWindowSetAndOpenFailsWhenReadingCounterThenErrorIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.set(100000);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnFailure);
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+
+    uint64_t value = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", value));
+    EXPECT_FALSE(pPmt->snapshotValid);
+}
+
+ssize_t preadMockPmtSnapshotEndingWith32BitCounter(int fd, void *buf, size_t count, off_t offset) {
+    auto bytesRead = count - sizeof(uint32_t);
+    auto data = reinterpret_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < bytesRead; i++) {
+        data[i] = static_cast<uint8_t>(offset + i);
+    }
+    return bytesRead;
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWindowSetAndRegionEndingWith32BitCounterWhenReadIsShortThenCountersWithinReadBytesAreServed) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.set(100000);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    pPmt->preadFunction = preadMockPmtSnapshotEndingWith32BitCounter;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x18}};
+
+    uint64_t valueA = 0;
+    uint32_t valueB = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", valueA));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_B", valueB));
+    EXPECT_TRUE(pPmt->snapshotValid);
+    EXPECT_EQ(0xcu, pPmt->snapshot.size());
+    EXPECT_EQ(0x1716151413121110u, valueA);
+    EXPECT_EQ(0x1b1a1918u, valueB);
+
+    uint64_t wideValueB = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("KEY_B", wideValueB));
+}
+
+uint32_t openMockPmtSnapshotCalled = 0;
+
+int openMockPmtSnapshot(const char *pathname, int flags) {
+    openMockPmtSnapshotCalled++;
+    return 0;
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWindowSetWhenSnapshotIsRefreshedThenTelemetryFileIsOpenedOnce) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySnapshotWindow.set(100000);
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockPmtSnapshot);
+    pPmt->preadFunction = preadMockPmtSnapshot;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}};
+    openMockPmtSnapshotCalled = 0;
+    preadMockPmtSnapshotCalled = 0;
+
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        pPmt->snapshotTimestamp -= std::chrono::milliseconds(100000);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", value));
+    }
+    EXPECT_EQ(3u, preadMockPmtSnapshotCalled);
+    EXPECT_EQ(1u, openMockPmtSnapshotCalled);
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     auto subDeviceCount = pLinuxSysmanImp->getSubDeviceCount();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace L0 {
@@ -419,7 +420,6 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
                                                                 uint32_t &metricValueCount,
                                                                 zet_typed_value_t *pCalculatedData) {
     bool dataOverflow = false;
-    StallSumIpDataMap_t stallSumIpDataMap;
 
     // MAX_METRIC_VALUES is not supported yet.
     if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
@@ -434,16 +434,23 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
+    const size_t rawReportCount = rawDataSize / rawReportSize;
 
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= stallIpDataMapUpdate(stallSumIpDataMap, pRawIpData);
+    std::vector<StallIpSample> samples(rawReportCount);
+    for (size_t i = 0; i < rawReportCount; i++) {
+        dataOverflow |= stallIpDataDecode(pRawData + i * rawReportSize, samples[i]);
     }
 
-    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallSumIpDataMap.size()) * properties.metricCount);
+    stallIpSamplesSort(samples);
+
+    StallSumIpDataList_t stallSumIpDataList;
+    stallIpSamplesReduce(samples, stallSumIpDataList);
+
+    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallSumIpDataList.size()) * properties.metricCount);
     std::vector<zet_typed_value_t> ipDataValues;
+    ipDataValues.reserve(properties.metricCount);
     uint32_t i = 0;
-    for (auto it = stallSumIpDataMap.begin(); it != stallSumIpDataMap.end(); ++it) {
+    for (auto it = stallSumIpDataList.begin(); (it != stallSumIpDataList.end()) && (i < metricValueCount); ++it) {
         stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
         for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
             *(pCalculatedData + i) = *jt;
@@ -474,45 +481,98 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
  *
  * total size 64 bytes
  */
-bool IpSamplingMetricGroupImp::stallIpDataMapUpdate(StallSumIpDataMap_t &stallSumIpDataMap, const uint8_t *pRawIpData) {
-
-    const uint8_t *tempAddr = pRawIpData;
-    uint64_t ip = 0ULL;
-    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
-    ip &= 0x1fffffff;
-    StallSumIpData_t &stallSumData = stallSumIpDataMap[ip];
-    tempAddr += 3;
-
-    auto getCount = [&tempAddr]() {
-        uint16_t tempCount = 0;
-        memcpy_s(reinterpret_cast<uint8_t *>(&tempCount), sizeof(tempCount), tempAddr, sizeof(tempCount));
-        tempCount = (tempCount >> 5) & 0xff;
-        tempAddr += 1;
-        return static_cast<uint8_t>(tempCount);
-    };
-
-    stallSumData.activeCount += getCount();
-    stallSumData.otherCount += getCount();
-    stallSumData.controlCount += getCount();
-    stallSumData.pipeStallCount += getCount();
-    stallSumData.sendCount += getCount();
-    stallSumData.distAccCount += getCount();
-    stallSumData.sbidCount += getCount();
-    stallSumData.syncCount += getCount();
-    stallSumData.instFetchCount += getCount();
+bool IpSamplingMetricGroupImp::stallIpDataDecode(const uint8_t *pRawIpData, StallIpSample &sample) {
+    constexpr uint32_t ipBits = 29;
+    constexpr uint32_t countBits = 8;
+    constexpr uint32_t countMask = (1u << countBits) - 1;
+
+    // All fields of interest are within the first two qwords, extract them with shifts instead of byte-wise copies.
+    uint64_t rawData[2] = {};
+    memcpy_s(rawData, sizeof(rawData), pRawIpData, sizeof(rawData));
+
+    sample.ip = static_cast<uint32_t>(rawData[0] & ((1u << ipBits) - 1));
+    for (uint32_t i = 0; i < sizeof(sample.counts); i++) {
+        const uint32_t bitOffset = ipBits + i * countBits;
+        uint64_t count = 0;
+        if (bitOffset >= 64) {
+            count = rawData[1] >> (bitOffset - 64);
+        } else {
+            count = rawData[0] >> bitOffset;
+            if (bitOffset + countBits > 64) {
+                count |= rawData[1] << (64 - bitOffset);
+            }
+        }
+        sample.counts[i] = static_cast<uint8_t>(count & countMask);
+    }
 
     struct StallCntrInfo {
         uint16_t subslice;
         uint16_t flags;
     } stallCntrInfo = {};
 
-    tempAddr = pRawIpData + 48;
-    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), tempAddr, sizeof(stallCntrInfo));
+    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), pRawIpData + 48, sizeof(stallCntrInfo));
 
     constexpr int overflowDropFlag = (1 << 8);
     return stallCntrInfo.flags & overflowDropFlag;
 }
 
+// LSD radix sort by IP. Sort is stable and takes at most three passes over 29-bit IPs,
+// passes where all samples fall into a single bucket are skipped.
+void IpSamplingMetricGroupImp::stallIpSamplesSort(std::vector<StallIpSample> &samples) {
+    constexpr uint32_t ipBits = 29;
+    constexpr uint32_t radixBits = 10;
+    constexpr uint32_t bucketCount = 1u << radixBits;
+    constexpr uint32_t bucketMask = bucketCount - 1;
+
+    if (samples.size() < bucketCount) {
+        std::stable_sort(samples.begin(), samples.end(), [](const StallIpSample &lhs, const StallIpSample &rhs) { return lhs.ip < rhs.ip; });
+        return;
+    }
+
+    std::vector<StallIpSample> sortedSamples(samples.size());
+    std::vector<size_t> bucketOffsets(bucketCount);
+    for (uint32_t shift = 0; shift < ipBits; shift += radixBits) {
+        std::fill(bucketOffsets.begin(), bucketOffsets.end(), 0u);
+        for (const auto &sample : samples) {
+            bucketOffsets[(sample.ip >> shift) & bucketMask]++;
+        }
+        if (bucketOffsets[(samples[0].ip >> shift) & bucketMask] == samples.size()) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (auto &bucketOffset : bucketOffsets) {
+            auto bucketSize = bucketOffset;
+            bucketOffset = offset;
+            offset += bucketSize;
+        }
+        for (const auto &sample : samples) {
+            sortedSamples[bucketOffsets[(sample.ip >> shift) & bucketMask]++] = sample;
+        }
+        samples.swap(sortedSamples);
+    }
+}
+
+// Samples must be sorted by IP, every run of equal IPs is summed into a single entry.
+void IpSamplingMetricGroupImp::stallIpSamplesReduce(const std::vector<StallIpSample> &samples, StallSumIpDataList_t &stallSumIpDataList) {
+    for (const auto &sample : samples) {
+        if (stallSumIpDataList.empty() || stallSumIpDataList.back().first != sample.ip) {
+            stallSumIpDataList.push_back({sample.ip, {}});
+        }
+
+        StallSumIpData_t &stallSumData = stallSumIpDataList.back().second;
+        stallSumData.activeCount += sample.counts[0];
+        stallSumData.otherCount += sample.counts[1];
+        stallSumData.controlCount += sample.counts[2];
+        stallSumData.pipeStallCount += sample.counts[3];
+        stallSumData.sendCount += sample.counts[4];
+        stallSumData.distAccCount += sample.counts[5];
+        stallSumData.sbidCount += sample.counts[6];
+        stallSumData.syncCount += sample.counts[7];
+        stallSumData.instFetchCount += sample.counts[8];
+    }
+}
+
 // The order of push_back calls must match the order of metricPropertiesList.
 void IpSamplingMetricGroupImp::stallSumIpDataToTypedValues(uint64_t ip,
                                                            StallSumIpData_t &sumIpData,
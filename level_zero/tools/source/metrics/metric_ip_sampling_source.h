@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,7 +62,13 @@ typedef struct StallSumIpData {
     uint64_t instFetchCount;
 } StallSumIpData_t;
 
-typedef std::map<uint64_t, StallSumIpData_t> StallSumIpDataMap_t;
+// Counters of a single raw report, in raw report order (active, other, control, pipestall, send, dist_acc, sbid, sync, inst_fetch).
+struct StallIpSample {
+    uint32_t ip;
+    uint8_t counts[9];
+};
+
+typedef std::vector<std::pair<uint64_t, StallSumIpData_t>> StallSumIpDataList_t;
 
 struct IpSamplingMetricGroupBase : public MetricGroupImp {
     IpSamplingMetricGroupBase(MetricSource &metricSource) : MetricGroupImp(metricSource) {}
@@ -115,7 +121,9 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData);
-    bool stallIpDataMapUpdate(StallSumIpDataMap_t &, const uint8_t *pRawIpData);
+    static bool stallIpDataDecode(const uint8_t *pRawIpData, StallIpSample &sample);
+    static void stallIpSamplesSort(std::vector<StallIpSample> &samples);
+    static void stallIpSamplesReduce(const std::vector<StallIpSample> &samples, StallSumIpDataList_t &stallSumIpDataList);
     void stallSumIpDataToTypedValues(uint64_t ip, StallSumIpData_t &sumIpData, std::vector<zet_typed_value_t> &ipDataValues);
     bool isMultiDeviceCaptureData(const size_t rawDataSize, const uint8_t *pRawData);
 };
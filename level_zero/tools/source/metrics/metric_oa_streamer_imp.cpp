@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,12 +52,17 @@ ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawD
         uint32_t *pRawDataOffsetsUnpacked = reinterpret_cast<uint32_t *>(pRawData + pRawDataHeader->rawDataOffsets);
         uint32_t *pRawDataSizesUnpacked = reinterpret_cast<uint32_t *>(pRawData + pRawDataHeader->rawDataSizes);
         uint8_t *pRawDataUnpacked = reinterpret_cast<uint8_t *>(pRawData + pRawDataHeader->rawDataOffset);
+        size_t remainingSize = sizePerSubDevice * metricStreamerSize;
 
         for (size_t i = 0; i < metricStreamerSize; ++i) {
 
-            size_t readSize = sizePerSubDevice;
+            // Space not used by previous sub-devices is given to the next one, while each of the remaining
+            // sub-devices keeps its equal share. Busy sub-devices are drained with fewer read calls.
+            // A single sub-device never reads more than maxReportCount reports.
             const uint32_t rawDataOffset = (i != 0) ? (pRawDataSizesUnpacked[i - 1] + pRawDataOffsetsUnpacked[i - 1]) : 0;
             pMetricStreamer = MetricStreamer::fromHandle(metricStreamers[i]);
+            size_t readSize = remainingSize - sizePerSubDevice * (metricStreamerSize - i - 1);
+            readSize = std::min(readSize, static_cast<size_t>(static_cast<OaMetricStreamerImp *>(pMetricStreamer)->getRequiredBufferSize(maxReportCount)));
             result = pMetricStreamer->readData(maxReportCount, &readSize, pRawDataUnpacked + rawDataOffset);
             // Return at first error.
             if (result != ZE_RESULT_SUCCESS) {
@@ -66,6 +71,7 @@ ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawD
             pRawDataSizesUnpacked[i] = static_cast<uint32_t>(readSize);
             pRawDataOffsetsUnpacked[i] = (i != 0) ? pRawDataOffsetsUnpacked[i - 1] + pRawDataSizesUnpacked[i - 1] : 0;
             *pRawDataSize += readSize;
+            remainingSize -= readSize;
         }
     } else {
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -187,6 +187,7 @@ class Mock<IConcurrentGroup_1_5> : public IConcurrentGroup_1_5 {
         return openIoStreamResult;
     }
     TCompletionCode ReadIoStream(uint32_t *reportsCount, char *reportData, uint32_t readFlags) override {
+        readIoStreamInReportsCount.push_back(*reportsCount);
         if (!readIoStreamOutReportsCount.empty()) {
             *reportsCount = readIoStreamOutReportsCount.back();
             readIoStreamOutReportsCount.pop_back();
@@ -198,6 +199,7 @@ class Mock<IConcurrentGroup_1_5> : public IConcurrentGroup_1_5 {
     IMetricSet_1_5 *getMetricSetResult = nullptr;
     std::vector<IMetricSet_1_5 *> getMetricSetResults;
     std::vector<uint32_t> readIoStreamOutReportsCount{};
+    std::vector<uint32_t> readIoStreamInReportsCount{};
     uint32_t *openIoStreamOutOaBufferSize = nullptr;
     TCompletionCode openIoStreamResult = TCompletionCode::CC_OK;
     TCompletionCode readIoStreamResult = TCompletionCode::CC_OK;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -763,6 +763,47 @@ TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCal
     }
 }
 
+TEST_F(MetricIpSamplingCalculateMetricsTest, GivenLargeNumberOfUnsortedReportsWhenCalculateMetricValuesIsCalledThenValuesAreAggregatedPerIpInAscendingIpOrder) {
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    constexpr uint32_t reportCount = 4096;
+    std::vector<MockStallRawIpData> largeRawDataVector;
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> expectedActiveCountAndOccurrences;
+    for (uint32_t i = 0; i < reportCount; i++) {
+        uint64_t ip = (i * 7919u) % 1500u + ((i % 2) ? 0x1000000u : 0u);
+        uint64_t activeCount = i % 256;
+        largeRawDataVector.push_back({ip, activeCount, 1, 1, 1, 1, 1, 1, 1, 1, 1000, 0x0});
+        expectedActiveCountAndOccurrences[ip].first += activeCount;
+        expectedActiveCountAndOccurrences[ip].second++;
+    }
+    size_t largeRawDataVectorSize = sizeof(largeRawDataVector[0]) * largeRawDataVector.size();
+
+    auto device = testDevices[0];
+    uint32_t metricGroupCount = 1;
+    zet_metric_group_handle_t metricGroupHandle = nullptr;
+    ASSERT_EQ(zetMetricGroupGet(device->toHandle(), &metricGroupCount, &metricGroupHandle), ZE_RESULT_SUCCESS);
+    ASSERT_NE(metricGroupHandle, nullptr);
+
+    const uint32_t metricsPerIp = 10;
+    uint32_t metricValueCount = static_cast<uint32_t>(expectedActiveCountAndOccurrences.size()) * metricsPerIp;
+    std::vector<zet_typed_value_t> metricValues(metricValueCount);
+    EXPECT_EQ(zetMetricGroupCalculateMetricValues(metricGroupHandle, ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                  largeRawDataVectorSize, reinterpret_cast<uint8_t *>(largeRawDataVector.data()), &metricValueCount, metricValues.data()),
+              ZE_RESULT_SUCCESS);
+    ASSERT_EQ(expectedActiveCountAndOccurrences.size() * metricsPerIp, metricValueCount);
+
+    uint32_t i = 0;
+    for (auto &expected : expectedActiveCountAndOccurrences) {
+        EXPECT_EQ(expected.first, metricValues[i].value.ui64);
+        EXPECT_EQ(expected.second.first, metricValues[i + 1].value.ui64);
+        for (uint32_t j = 2; j < metricsPerIp; j++) {
+            EXPECT_EQ(expected.second.second, metricValues[i + j].value.ui64);
+        }
+        i += metricsPerIp;
+    }
+}
+
 TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCalculateMetricValuesIsCalledWithDataFromMultipleSubdevicesThenReturnError) {
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
@@ -549,7 +549,13 @@ bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *cont
            (isSupportedForSingleDeviceContexts && context->isSingleDeviceContext());
 }
 
-Context::BufferPool::BufferPool(Context *context) : BaseType(context->memoryManager, nullptr) {
+const SmallBuffersPoolTier Context::BufferPoolAllocator::poolTiersDefinitions[Context::BufferPoolAllocator::maxPoolTiersCount] = {
+    {BufferPoolAllocator::smallBufferThreshold, BufferPoolAllocator::aggregatedSmallBuffersPoolSize},
+    {64 * MemoryConstants::kiloByte, 2 * MemoryConstants::megaByte},
+    {MemoryConstants::megaByte, 16 * MemoryConstants::megaByte}};
+
+Context::BufferPool::BufferPool(Context *context, size_t poolSize, uint32_t tierIndex) : BaseType(context->memoryManager, nullptr) {
+    this->tierIndex = tierIndex;
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
     Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
@@ -557,13 +563,13 @@ Context::BufferPool::BufferPool(Context *context) : BaseType(context->memoryMana
     bufferCreateArgs.makeAllocationLockable = true;
     this->mainStorage.reset(Buffer::create(context,
                                            flags,
-                                           BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
+                                           poolSize,
                                            nullptr,
                                            bufferCreateArgs,
                                            errcodeRet));
     if (this->mainStorage) {
         this->chunkAllocator.reset(new HeapAllocator(BufferPool::startingOffset,
-                                                     BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
+                                                     poolSize,
                                                      BufferPoolAllocator::chunkAlignment));
         context->decRefInternal();
     }
@@ -595,7 +601,19 @@ Buffer *Context::BufferPool::allocate(const MemoryProperties &memoryProperties,
 
 void Context::BufferPoolAllocator::initAggregatedSmallBuffers(Context *context) {
     this->context = context;
-    this->addNewBufferPool(Context::BufferPool{this->context});
+
+    auto poolTiersCount = 1u;
+    if (debugManager.flags.ExperimentalSmallBufferPoolAllocatorTiers.get() != -1) {
+        poolTiersCount = static_cast<uint32_t>(std::clamp(debugManager.flags.ExperimentalSmallBufferPoolAllocatorTiers.get(), 1, static_cast<int32_t>(maxPoolTiersCount)));
+    }
+    this->setPoolTiers({std::begin(poolTiersDefinitions), std::begin(poolTiersDefinitions) + poolTiersCount});
+
+    if (debugManager.flags.ExperimentalSmallBufferPoolAllocatorDrainOnFree.get() != -1) {
+        this->drainOnFree = !!debugManager.flags.ExperimentalSmallBufferPoolAllocatorDrainOnFree.get();
+    }
+
+    // Pools of larger tiers are created on first request of a given size
+    this->addNewBufferPool(Context::BufferPool{this->context, this->poolTiers[0].poolSize, 0u});
 }
 
 Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
@@ -612,20 +630,24 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
     }
 
     auto lock = std::unique_lock<std::mutex>(mutex);
-    auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    const auto tierIndex = this->getPoolTierIndex(requestedSize);
+    auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, tierIndex);
     if (bufferFromPool != nullptr) {
+        this->registerPoolTierAllocation(tierIndex, true);
         return bufferFromPool;
     }
 
-    this->drain();
+    this->drainPoolTier(tierIndex);
 
-    bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, tierIndex);
     if (bufferFromPool != nullptr) {
+        this->registerPoolTierAllocation(tierIndex, true);
         return bufferFromPool;
     }
 
-    this->addNewBufferPool(BufferPool{this->context});
-    return this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    this->registerPoolTierAllocation(tierIndex, false);
+    this->addNewBufferPool(BufferPool{this->context, this->poolTiers[tierIndex].poolSize, tierIndex});
+    return this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, tierIndex);
 }
 
 Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &memoryProperties,
@@ -633,8 +655,12 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
                                                         cl_mem_flags_intel flagsIntel,
                                                         size_t requestedSize,
                                                         void *hostPtr,
-                                                        cl_int &errcodeRet) {
+                                                        cl_int &errcodeRet,
+                                                        uint32_t tierIndex) {
     for (auto &bufferPoolParent : this->bufferPools) {
+        if (bufferPoolParent.tierIndex != tierIndex) {
+            continue;
+        }
         auto &bufferPool = static_cast<BufferPool &>(bufferPoolParent);
         auto bufferFromPool = bufferPool.allocate(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
         if (bufferFromPool != nullptr) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,7 +56,7 @@ class Context : public BaseObject<_cl_context> {
     struct BufferPool : public AbstractBuffersPool<BufferPool, Buffer, MemObj> {
         using BaseType = AbstractBuffersPool<BufferPool, Buffer, MemObj>;
 
-        BufferPool(Context *context);
+        BufferPool(Context *context, size_t poolSize, uint32_t tierIndex);
         Buffer *allocate(const MemoryProperties &memoryProperties,
                          cl_mem_flags flags,
                          cl_mem_flags_intel flagsIntel,
@@ -79,13 +79,17 @@ class Context : public BaseObject<_cl_context> {
                                        cl_int &errcodeRet);
         bool flagsAllowBufferFromPool(const cl_mem_flags &flags, const cl_mem_flags_intel &flagsIntel) const;
 
+        static constexpr uint32_t maxPoolTiersCount = 3u;
+        static const SmallBuffersPoolTier poolTiersDefinitions[maxPoolTiersCount];
+
       protected:
         Buffer *allocateFromPools(const MemoryProperties &memoryProperties,
                                   cl_mem_flags flags,
                                   cl_mem_flags_intel flagsIntel,
                                   size_t requestedSize,
                                   void *hostPtr,
-                                  cl_int &errcodeRet);
+                                  cl_int &errcodeRet,
+                                  uint32_t tierIndex);
 
         Context *context{nullptr};
     };
@@ -874,6 +874,9 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
         if (argIndex >= kernelArgHandlers.size()) {
             return CL_INVALID_ARG_INDEX;
         }
+        if (kernelInfo.builtinDispatchBuilder == nullptr && isImmediateArgUnchanged(argIndex, argSize, argVal)) {
+            return CL_SUCCESS;
+        }
         argWasUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         auto argHandler = kernelArgHandlers[argIndex];
         retVal = (this->*argHandler)(argIndex, argSize, argVal);
@@ -1702,6 +1705,30 @@ cl_int Kernel::setArgImmediate(uint32_t argIndex,
     return retVal;
 }
 
+bool Kernel::isImmediateArgUnchanged(uint32_t argIndex, size_t argSize, const void *argVal) const {
+    const auto &kernelArg = kernelArguments[argIndex];
+    if (!kernelArg.isPatched ||
+        kernelArg.type != NONE_OBJ ||
+        kernelArg.size != argSize ||
+        argVal == nullptr ||
+        kernelArgHandlers[argIndex] != &Kernel::setArgImmediate) {
+        return false;
+    }
+
+    // Value is compared against cross thread data itself, so no separate copy of the argument is kept
+    const auto &argAsVal = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescValue>();
+    for (const auto &element : argAsVal.elements) {
+        if (element.sourceOffset >= argSize) {
+            continue;
+        }
+        size_t bytesToCompare = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+        if (memcmp(ptrOffset(crossThreadData, element.offset), ptrOffset(argVal, element.sourceOffset), bytesToCompare) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 cl_int Kernel::setArgSampler(uint32_t argIndex,
                              size_t argSize,
                              const void *argVal) {
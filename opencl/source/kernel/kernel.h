@@ -235,6 +235,10 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
                            size_t argSize,
                            const void *argVal);
 
+    bool isImmediateArgUnchanged(uint32_t argIndex,
+                                 size_t argSize,
+                                 const void *argVal) const;
+
     cl_int setArgBuffer(uint32_t argIndex,
                         size_t argSize,
                         const void *argVal);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/command_queue/csr_selection_args.h"
+#include "opencl/source/context/context.h"
 
 namespace NEO {
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
@@ -33,6 +34,30 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     UNRECOVERABLE_IF(allocData == nullptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto unifiedMemoryManager = commandQueue->getContext().getSVMAllocsManager();
+    auto allocData = unifiedMemoryManager->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    // range may consist of several chunks mapped separately, their map operations are replaced with a single one
+    auto basePtr = allocData->cpuAllocation->getUnderlyingBuffer();
+    unifiedMemoryManager->removeSvmMapOperations(ptr, size);
+    unifiedMemoryManager->insertSvmMapOperation(ptr, size, basePtr, ptrDiff(ptr, basePtr), false);
+    auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+void PageFaultManager::releaseCleanRange(void *ptr, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    commandQueue->getContext().getSVMAllocsManager()->removeSvmMapOperations(ptr, size);
+}
+bool PageFaultManager::isChunkedMigrationSupported() {
+    return true;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     auto commandQueue = static_cast<CommandQueue *>(pageFaultData.cmdQ);
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_builtin.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/utilities/api_binary_tracer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+
+namespace HostSideTracing {
+
+BuiltinTracer *pGlobalBuiltinTracer = nullptr;
+
+struct GlobalBuiltinTracer {
+    ~GlobalBuiltinTracer() {
+        pGlobalBuiltinTracer = nullptr;
+        tracer.reset();
+    }
+    std::unique_ptr<BuiltinTracer> tracer;
+} globalBuiltinTracer;
+
+BuiltinTracer *getBuiltinTracer() {
+    static std::once_flag initializeOnce;
+    std::call_once(initializeOnce, []() {
+        globalBuiltinTracer.tracer = BuiltinTracer::create();
+        if (globalBuiltinTracer.tracer) {
+            pGlobalBuiltinTracer = globalBuiltinTracer.tracer.get();
+        }
+    });
+    return pGlobalBuiltinTracer;
+}
+
+void ApiStatistics::record(ClFunctionId functionId, const char *functionName, uint64_t duration) {
+    auto &statistics = functions[functionId];
+    statistics.name.store(functionName, std::memory_order_relaxed);
+    statistics.callCount.fetch_add(1, std::memory_order_relaxed);
+    statistics.totalTime.fetch_add(duration, std::memory_order_relaxed);
+
+    uint32_t bucket = duration > 0 ? std::min(Math::log2(duration), histogramBucketCount - 1) : 0u;
+    statistics.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string ApiStatistics::toString() const {
+    std::stringstream output;
+    output << "OpenCL API statistics:\n";
+    for (auto &statistics : functions) {
+        auto callCount = statistics.callCount.load(std::memory_order_relaxed);
+        if (callCount == 0) {
+            continue;
+        }
+        auto totalTime = statistics.totalTime.load(std::memory_order_relaxed);
+        output << statistics.name.load(std::memory_order_relaxed) << " calls: " << callCount
+               << " total [ns]: " << totalTime << " average [ns]: " << totalTime / callCount
+               << " histogram [ns]:";
+        for (uint32_t bucket = 0; bucket < histogramBucketCount; bucket++) {
+            auto bucketCount = statistics.histogram[bucket].load(std::memory_order_relaxed);
+            if (bucketCount > 0) {
+                output << " <" << (2ull << bucket) << ": " << bucketCount;
+            }
+        }
+        output << "\n";
+    }
+    return output.str();
+}
+
+BuiltinTracer::BuiltinTracer() = default;
+
+BuiltinTracer::~BuiltinTracer() {
+    if (apiStatistics) {
+        auto statistics = apiStatistics->toString();
+        NEO::printDebugString(true, stdout, "%s", statistics.c_str());
+    }
+}
+
+std::unique_ptr<BuiltinTracer> BuiltinTracer::create() {
+    auto binaryTraceFile = NEO::debugManager.flags.ClApiBinaryTraceFile.get();
+    bool printStatistics = NEO::debugManager.flags.PrintClApiStatistics.get();
+    if (binaryTraceFile == "unk" && !printStatistics) {
+        return nullptr;
+    }
+
+    auto tracer = std::make_unique<BuiltinTracer>();
+    if (binaryTraceFile != "unk") {
+        tracer->binaryTracer = NEO::ApiBinaryTracer::create(binaryTraceFile);
+    }
+    if (printStatistics) {
+        tracer->apiStatistics = std::make_unique<ApiStatistics>();
+    }
+    return tracer;
+}
+
+void BuiltinTracer::record(ClFunctionId functionId, const char *functionName, uint64_t handle, uint64_t startTimestamp, int32_t result) {
+    const uint64_t endTimestamp = NEO::ApiBinaryTracer::getTimestamp();
+    if (binaryTracer) {
+        binaryTracer->record(static_cast<uint64_t>(functionId), handle, startTimestamp, endTimestamp, result);
+    }
+    if (apiStatistics) {
+        apiStatistics->record(functionId, functionName, endTimestamp - startTimestamp);
+    }
+}
+
+} // namespace HostSideTracing
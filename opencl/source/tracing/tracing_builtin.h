@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/api_binary_tracer.h"
+
+#include "opencl/source/tracing/tracing_types.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace HostSideTracing {
+
+// Call count and latency histogram of every API function, bucket i counts calls that took [2^i, 2^(i+1)) ns.
+class ApiStatistics : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t histogramBucketCount = 40;
+
+    struct FunctionStatistics {
+        std::atomic<const char *> name{nullptr};
+        std::atomic<uint64_t> callCount{0};
+        std::atomic<uint64_t> totalTime{0};
+        std::atomic<uint64_t> histogram[histogramBucketCount] = {};
+    };
+
+    void record(ClFunctionId functionId, const char *functionName, uint64_t duration);
+    std::string toString() const;
+
+    FunctionStatistics functions[CL_FUNCTION_COUNT];
+};
+
+// Trace sinks selected with debug flags, independent of handles created with clCreateTracingHandleINTEL.
+// ClApiBinaryTraceFile stores a binary record of every API call, PrintClApiStatistics prints ApiStatistics at exit.
+class BuiltinTracer : NEO::NonCopyableOrMovableClass {
+  public:
+    BuiltinTracer();
+    ~BuiltinTracer();
+
+    static std::unique_ptr<BuiltinTracer> create();
+
+    void record(ClFunctionId functionId, const char *functionName, uint64_t handle, uint64_t startTimestamp, int32_t result);
+
+    std::unique_ptr<NEO::ApiBinaryTracer> binaryTracer;
+    std::unique_ptr<ApiStatistics> apiStatistics;
+};
+
+BuiltinTracer *getBuiltinTracer();
+extern BuiltinTracer *pGlobalBuiltinTracer;
+
+inline thread_local bool builtinTracingInProgress = false;
+
+template <typename T, typename... Rest>
+uint64_t getTracedHandle(T *firstParam, Rest...) {
+    if constexpr (std::is_pointer_v<std::remove_cv_t<T>>) {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(*firstParam));
+    } else {
+        return 0;
+    }
+}
+
+inline uint64_t getTracedHandle() {
+    return 0;
+}
+
+inline int32_t getTracedResult(cl_int *retVal) {
+    return *retVal;
+}
+
+template <typename T>
+int32_t getTracedResult(T) {
+    return NEO::ApiBinaryTraceRecord::noResult;
+}
+
+// Create-style calls report their status through errcodeRet, which is always their last parameter.
+inline cl_int **getTracedErrcodeRet() {
+    return nullptr;
+}
+
+template <typename T>
+cl_int **getTracedErrcodeRet(T lastParam) {
+    if constexpr (std::is_same_v<T, cl_int **>) {
+        return lastParam;
+    } else {
+        return nullptr;
+    }
+}
+
+template <typename T, typename... Rest>
+cl_int **getTracedErrcodeRet(T, Rest... rest) {
+    return getTracedErrcodeRet(rest...);
+}
+
+// Records the call when leaving the API function, so returns that skip TRACING_EXIT still reset
+// builtinTracingInProgress.
+template <typename FunctionTracer>
+class BuiltinTraceScope : NEO::NonCopyableOrMovableClass {
+  public:
+    template <typename... Params>
+    BuiltinTraceScope(Params... params) {
+        if (builtinTracingInProgress) {
+            return;
+        }
+        tracer = getBuiltinTracer();
+        if (tracer) {
+            builtinTracingInProgress = true;
+            handle = getTracedHandle(params...);
+            errcodeRet = getTracedErrcodeRet(params...);
+            startTimestamp = NEO::ApiBinaryTracer::getTimestamp();
+        }
+    }
+
+    ~BuiltinTraceScope() {
+        if (tracer) {
+            if (result == NEO::ApiBinaryTraceRecord::noResult && errcodeRet && *errcodeRet) {
+                result = **errcodeRet;
+            }
+            tracer->record(FunctionTracer::functionId, FunctionTracer::functionName, handle, startTimestamp, result);
+            builtinTracingInProgress = false;
+        }
+    }
+
+    template <typename... Params>
+    void exit(Params... params) {
+        result = getTracedResult(params...);
+    }
+
+  protected:
+    BuiltinTracer *tracer = nullptr;
+    cl_int **errcodeRet = nullptr;
+    uint64_t handle = 0;
+    uint64_t startTimestamp = 0;
+    int32_t result = NEO::ApiBinaryTraceRecord::noResult;
+};
+
+} // namespace HostSideTracing
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_binary_tracer.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include "opencl/source/tracing/tracing_builtin.h"
 #include "opencl/source/tracing/tracing_handle.h"
 
 #include <atomic>
@@ -40,17 +42,19 @@ inline thread_local bool tracingInProgress = false;
         if (isHostSideTracingEnabled_##name) {                                                                                                     \
             tracer_##name.enter(__VA_ARGS__);                                                                                                      \
         }                                                                                                                                          \
-    }
-
-#define TRACING_EXIT(name, ...)                     \
-    if (currentlyTracedCall) {                      \
-        if (isHostSideTracingEnabled_##name) {      \
-            tracer_##name.exit(__VA_ARGS__);        \
-            HostSideTracing::removeTracingClient(); \
-        }                                           \
-        HostSideTracing::tracingInProgress = false; \
-        currentlyTracedCall = false;                \
-    }
+    }                                                                                                                                              \
+    HostSideTracing::BuiltinTraceScope<HostSideTracing::name##Tracer> builtinTraceScope_##name{__VA_ARGS__};
+
+#define TRACING_EXIT(name, ...)                                                                                   \
+    if (currentlyTracedCall) {                                                                                    \
+        if (isHostSideTracingEnabled_##name) {                                                                    \
+            tracer_##name.exit(__VA_ARGS__);                                                                      \
+            HostSideTracing::removeTracingClient();                                                               \
+        }                                                                                                         \
+        HostSideTracing::tracingInProgress = false;                                                               \
+        currentlyTracedCall = false;                                                                              \
+    }                                                                                                             \
+    builtinTraceScope_##name.exit(__VA_ARGS__);
 
 enum TracingNotifyState {
     TRACING_NOTIFY_STATE_NOTHING_CALLED = 0,
@@ -94,6 +98,9 @@ class ClBuildProgramTracer {
   public:
     ClBuildProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clBuildProgram;
+    static constexpr const char *functionName = "clBuildProgram";
+
     void enter(cl_program *program,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -165,6 +172,9 @@ class ClCloneKernelTracer {
   public:
     ClCloneKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCloneKernel;
+    static constexpr const char *functionName = "clCloneKernel";
+
     void enter(cl_kernel *sourceKernel,
                cl_int **errcodeRet) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -228,6 +238,9 @@ class ClCompileProgramTracer {
   public:
     ClCompileProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCompileProgram;
+    static constexpr const char *functionName = "clCompileProgram";
+
     void enter(cl_program *program,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -305,6 +318,9 @@ class ClCreateBufferTracer {
   public:
     ClCreateBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateBuffer;
+    static constexpr const char *functionName = "clCreateBuffer";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                size_t *size,
@@ -374,6 +390,9 @@ class ClCreateCommandQueueTracer {
   public:
     ClCreateCommandQueueTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateCommandQueue;
+    static constexpr const char *functionName = "clCreateCommandQueue";
+
     void enter(cl_context *context,
                cl_device_id *device,
                cl_command_queue_properties *properties,
@@ -441,6 +460,9 @@ class ClCreateCommandQueueWithPropertiesTracer {
   public:
     ClCreateCommandQueueWithPropertiesTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateCommandQueueWithProperties;
+    static constexpr const char *functionName = "clCreateCommandQueueWithProperties";
+
     void enter(cl_context *context,
                cl_device_id *device,
                const cl_queue_properties **properties,
@@ -508,6 +530,9 @@ class ClCreateContextTracer {
   public:
     ClCreateContextTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateContext;
+    static constexpr const char *functionName = "clCreateContext";
+
     void enter(const cl_context_properties **properties,
                cl_uint *numDevices,
                const cl_device_id **devices,
@@ -579,6 +604,9 @@ class ClCreateContextFromTypeTracer {
   public:
     ClCreateContextFromTypeTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateContextFromType;
+    static constexpr const char *functionName = "clCreateContextFromType";
+
     void enter(const cl_context_properties **properties,
                cl_device_type *deviceType,
                void(CL_CALLBACK **funcNotify)(const char *, const void *, size_t, void *),
@@ -648,6 +676,9 @@ class ClCreateImageTracer {
   public:
     ClCreateImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateImage;
+    static constexpr const char *functionName = "clCreateImage";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -719,6 +750,9 @@ class ClCreateImage2DTracer {
   public:
     ClCreateImage2DTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateImage2D;
+    static constexpr const char *functionName = "clCreateImage2D";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -794,6 +828,9 @@ class ClCreateImage3DTracer {
   public:
     ClCreateImage3DTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateImage3D;
+    static constexpr const char *functionName = "clCreateImage3D";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                const cl_image_format **imageFormat,
@@ -873,6 +910,9 @@ class ClCreateKernelTracer {
   public:
     ClCreateKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateKernel;
+    static constexpr const char *functionName = "clCreateKernel";
+
     void enter(cl_program *program,
                const char **kernelName,
                cl_int **errcodeRet) {
@@ -938,6 +978,9 @@ class ClCreateKernelsInProgramTracer {
   public:
     ClCreateKernelsInProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateKernelsInProgram;
+    static constexpr const char *functionName = "clCreateKernelsInProgram";
+
     void enter(cl_program *program,
                cl_uint *numKernels,
                cl_kernel **kernels,
@@ -1005,6 +1048,9 @@ class ClCreateSubDevicesTracer {
   public:
     ClCreateSubDevicesTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateSubDevices;
+    static constexpr const char *functionName = "clCreateSubDevices";
+
     void enter(cl_device_id *inDevice,
                const cl_device_partition_property **properties,
                cl_uint *numDevices,
@@ -1074,6 +1120,9 @@ class ClCreatePipeTracer {
   public:
     ClCreatePipeTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreatePipe;
+    static constexpr const char *functionName = "clCreatePipe";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_uint *pipePacketSize,
@@ -1145,6 +1194,9 @@ class ClCreateProgramWithBinaryTracer {
   public:
     ClCreateProgramWithBinaryTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateProgramWithBinary;
+    static constexpr const char *functionName = "clCreateProgramWithBinary";
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -1218,6 +1270,9 @@ class ClCreateProgramWithBuiltInKernelsTracer {
   public:
     ClCreateProgramWithBuiltInKernelsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateProgramWithBuiltInKernels;
+    static constexpr const char *functionName = "clCreateProgramWithBuiltInKernels";
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -1287,6 +1342,9 @@ class ClCreateProgramWithIlTracer {
   public:
     ClCreateProgramWithIlTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateProgramWithIL;
+    static constexpr const char *functionName = "clCreateProgramWithIL";
+
     void enter(cl_context *context,
                const void **il,
                size_t *length,
@@ -1354,6 +1412,9 @@ class ClCreateProgramWithSourceTracer {
   public:
     ClCreateProgramWithSourceTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateProgramWithSource;
+    static constexpr const char *functionName = "clCreateProgramWithSource";
+
     void enter(cl_context *context,
                cl_uint *count,
                const char ***strings,
@@ -1423,6 +1484,9 @@ class ClCreateSamplerTracer {
   public:
     ClCreateSamplerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateSampler;
+    static constexpr const char *functionName = "clCreateSampler";
+
     void enter(cl_context *context,
                cl_bool *normalizedCoords,
                cl_addressing_mode *addressingMode,
@@ -1492,6 +1556,9 @@ class ClCreateSamplerWithPropertiesTracer {
   public:
     ClCreateSamplerWithPropertiesTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateSamplerWithProperties;
+    static constexpr const char *functionName = "clCreateSamplerWithProperties";
+
     void enter(cl_context *context,
                const cl_sampler_properties **samplerProperties,
                cl_int **errcodeRet) {
@@ -1557,6 +1624,9 @@ class ClCreateSubBufferTracer {
   public:
     ClCreateSubBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateSubBuffer;
+    static constexpr const char *functionName = "clCreateSubBuffer";
+
     void enter(cl_mem *buffer,
                cl_mem_flags *flags,
                cl_buffer_create_type *bufferCreateType,
@@ -1626,6 +1696,9 @@ class ClCreateUserEventTracer {
   public:
     ClCreateUserEventTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateUserEvent;
+    static constexpr const char *functionName = "clCreateUserEvent";
+
     void enter(cl_context *context,
                cl_int **errcodeRet) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -1689,6 +1762,9 @@ class ClEnqueueBarrierTracer {
   public:
     ClEnqueueBarrierTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueBarrier;
+    static constexpr const char *functionName = "clEnqueueBarrier";
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -1750,6 +1826,9 @@ class ClEnqueueBarrierWithWaitListTracer {
   public:
     ClEnqueueBarrierWithWaitListTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueBarrierWithWaitList;
+    static constexpr const char *functionName = "clEnqueueBarrierWithWaitList";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEventsInWaitList,
                const cl_event **eventWaitList,
@@ -1817,6 +1896,9 @@ class ClEnqueueCopyBufferTracer {
   public:
     ClEnqueueCopyBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueCopyBuffer;
+    static constexpr const char *functionName = "clEnqueueCopyBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstBuffer,
@@ -1894,6 +1976,9 @@ class ClEnqueueCopyBufferRectTracer {
   public:
     ClEnqueueCopyBufferRectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueCopyBufferRect;
+    static constexpr const char *functionName = "clEnqueueCopyBufferRect";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstBuffer,
@@ -1979,6 +2064,9 @@ class ClEnqueueCopyBufferToImageTracer {
   public:
     ClEnqueueCopyBufferToImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueCopyBufferToImage;
+    static constexpr const char *functionName = "clEnqueueCopyBufferToImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcBuffer,
                cl_mem *dstImage,
@@ -2056,6 +2144,9 @@ class ClEnqueueCopyImageTracer {
   public:
     ClEnqueueCopyImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueCopyImage;
+    static constexpr const char *functionName = "clEnqueueCopyImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcImage,
                cl_mem *dstImage,
@@ -2133,6 +2224,9 @@ class ClEnqueueCopyImageToBufferTracer {
   public:
     ClEnqueueCopyImageToBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueCopyImageToBuffer;
+    static constexpr const char *functionName = "clEnqueueCopyImageToBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *srcImage,
                cl_mem *dstBuffer,
@@ -2210,6 +2304,9 @@ class ClEnqueueFillBufferTracer {
   public:
     ClEnqueueFillBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueFillBuffer;
+    static constexpr const char *functionName = "clEnqueueFillBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                const void **pattern,
@@ -2287,6 +2384,9 @@ class ClEnqueueFillImageTracer {
   public:
     ClEnqueueFillImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueFillImage;
+    static constexpr const char *functionName = "clEnqueueFillImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                const void **fillColor,
@@ -2362,6 +2462,9 @@ class ClEnqueueMapBufferTracer {
   public:
     ClEnqueueMapBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueMapBuffer;
+    static constexpr const char *functionName = "clEnqueueMapBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingMap,
@@ -2441,6 +2544,9 @@ class ClEnqueueMapImageTracer {
   public:
     ClEnqueueMapImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueMapImage;
+    static constexpr const char *functionName = "clEnqueueMapImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingMap,
@@ -2524,6 +2630,9 @@ class ClEnqueueMarkerTracer {
   public:
     ClEnqueueMarkerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueMarker;
+    static constexpr const char *functionName = "clEnqueueMarker";
+
     void enter(cl_command_queue *commandQueue,
                cl_event **event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -2587,6 +2696,9 @@ class ClEnqueueMarkerWithWaitListTracer {
   public:
     ClEnqueueMarkerWithWaitListTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueMarkerWithWaitList;
+    static constexpr const char *functionName = "clEnqueueMarkerWithWaitList";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEventsInWaitList,
                const cl_event **eventWaitList,
@@ -2654,6 +2766,9 @@ class ClEnqueueMigrateMemObjectsTracer {
   public:
     ClEnqueueMigrateMemObjectsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueMigrateMemObjects;
+    static constexpr const char *functionName = "clEnqueueMigrateMemObjects";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numMemObjects,
                const cl_mem **memObjects,
@@ -2727,6 +2842,9 @@ class ClEnqueueNdRangeKernelTracer {
   public:
     ClEnqueueNdRangeKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueNDRangeKernel;
+    static constexpr const char *functionName = "clEnqueueNDRangeKernel";
+
     void enter(cl_command_queue *commandQueue,
                cl_kernel *kernel,
                cl_uint *workDim,
@@ -2804,6 +2922,9 @@ class ClEnqueueNativeKernelTracer {
   public:
     ClEnqueueNativeKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueNativeKernel;
+    static constexpr const char *functionName = "clEnqueueNativeKernel";
+
     void enter(cl_command_queue *commandQueue,
                void(CL_CALLBACK **userFunc)(void *),
                void **args,
@@ -2883,6 +3004,9 @@ class ClEnqueueReadBufferTracer {
   public:
     ClEnqueueReadBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueReadBuffer;
+    static constexpr const char *functionName = "clEnqueueReadBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingRead,
@@ -2960,6 +3084,9 @@ class ClEnqueueReadBufferRectTracer {
   public:
     ClEnqueueReadBufferRectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueReadBufferRect;
+    static constexpr const char *functionName = "clEnqueueReadBufferRect";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingRead,
@@ -3047,6 +3174,9 @@ class ClEnqueueReadImageTracer {
   public:
     ClEnqueueReadImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueReadImage;
+    static constexpr const char *functionName = "clEnqueueReadImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingRead,
@@ -3128,6 +3258,9 @@ class ClEnqueueSvmFreeTracer {
   public:
     ClEnqueueSvmFreeTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMFree;
+    static constexpr const char *functionName = "clEnqueueSVMFree";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numSvmPointers,
                void ***svmPointers,
@@ -3203,6 +3336,9 @@ class ClEnqueueSvmMapTracer {
   public:
     ClEnqueueSvmMapTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMMap;
+    static constexpr const char *functionName = "clEnqueueSVMMap";
+
     void enter(cl_command_queue *commandQueue,
                cl_bool *blockingMap,
                cl_map_flags *mapFlags,
@@ -3278,6 +3414,9 @@ class ClEnqueueSvmMemFillTracer {
   public:
     ClEnqueueSvmMemFillTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMMemFill;
+    static constexpr const char *functionName = "clEnqueueSVMMemFill";
+
     void enter(cl_command_queue *commandQueue,
                void **svmPtr,
                const void **pattern,
@@ -3353,6 +3492,9 @@ class ClEnqueueSvmMemcpyTracer {
   public:
     ClEnqueueSvmMemcpyTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMMemcpy;
+    static constexpr const char *functionName = "clEnqueueSVMMemcpy";
+
     void enter(cl_command_queue *commandQueue,
                cl_bool *blockingCopy,
                void **dstPtr,
@@ -3428,6 +3570,9 @@ class ClEnqueueSvmMigrateMemTracer {
   public:
     ClEnqueueSvmMigrateMemTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMMigrateMem;
+    static constexpr const char *functionName = "clEnqueueSVMMigrateMem";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numSvmPointers,
                const void ***svmPointers,
@@ -3503,6 +3648,9 @@ class ClEnqueueSvmUnmapTracer {
   public:
     ClEnqueueSvmUnmapTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueSVMUnmap;
+    static constexpr const char *functionName = "clEnqueueSVMUnmap";
+
     void enter(cl_command_queue *commandQueue,
                void **svmPtr,
                cl_uint *numEventsInWaitList,
@@ -3572,6 +3720,9 @@ class ClEnqueueTaskTracer {
   public:
     ClEnqueueTaskTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueTask;
+    static constexpr const char *functionName = "clEnqueueTask";
+
     void enter(cl_command_queue *commandQueue,
                cl_kernel *kernel,
                cl_uint *numEventsInWaitList,
@@ -3641,6 +3792,9 @@ class ClEnqueueUnmapMemObjectTracer {
   public:
     ClEnqueueUnmapMemObjectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueUnmapMemObject;
+    static constexpr const char *functionName = "clEnqueueUnmapMemObject";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *memobj,
                void **mappedPtr,
@@ -3712,6 +3866,9 @@ class ClEnqueueWaitForEventsTracer {
   public:
     ClEnqueueWaitForEventsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueWaitForEvents;
+    static constexpr const char *functionName = "clEnqueueWaitForEvents";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numEvents,
                const cl_event **eventList) {
@@ -3777,6 +3934,9 @@ class ClEnqueueWriteBufferTracer {
   public:
     ClEnqueueWriteBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueWriteBuffer;
+    static constexpr const char *functionName = "clEnqueueWriteBuffer";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingWrite,
@@ -3854,6 +4014,9 @@ class ClEnqueueWriteBufferRectTracer {
   public:
     ClEnqueueWriteBufferRectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueWriteBufferRect;
+    static constexpr const char *functionName = "clEnqueueWriteBufferRect";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *buffer,
                cl_bool *blockingWrite,
@@ -3941,6 +4104,9 @@ class ClEnqueueWriteImageTracer {
   public:
     ClEnqueueWriteImageTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueWriteImage;
+    static constexpr const char *functionName = "clEnqueueWriteImage";
+
     void enter(cl_command_queue *commandQueue,
                cl_mem *image,
                cl_bool *blockingWrite,
@@ -4022,6 +4188,9 @@ class ClFinishTracer {
   public:
     ClFinishTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clFinish;
+    static constexpr const char *functionName = "clFinish";
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -4083,6 +4252,9 @@ class ClFlushTracer {
   public:
     ClFlushTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clFlush;
+    static constexpr const char *functionName = "clFlush";
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -4144,6 +4316,9 @@ class ClGetCommandQueueInfoTracer {
   public:
     ClGetCommandQueueInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetCommandQueueInfo;
+    static constexpr const char *functionName = "clGetCommandQueueInfo";
+
     void enter(cl_command_queue *commandQueue,
                cl_command_queue_info *paramName,
                size_t *paramValueSize,
@@ -4213,6 +4388,9 @@ class ClGetContextInfoTracer {
   public:
     ClGetContextInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetContextInfo;
+    static constexpr const char *functionName = "clGetContextInfo";
+
     void enter(cl_context *context,
                cl_context_info *paramName,
                size_t *paramValueSize,
@@ -4282,6 +4460,9 @@ class ClGetDeviceAndHostTimerTracer {
   public:
     ClGetDeviceAndHostTimerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetDeviceAndHostTimer;
+    static constexpr const char *functionName = "clGetDeviceAndHostTimer";
+
     void enter(cl_device_id *device,
                cl_ulong **deviceTimestamp,
                cl_ulong **hostTimestamp) {
@@ -4347,6 +4528,9 @@ class ClGetDeviceIDsTracer {
   public:
     ClGetDeviceIDsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetDeviceIDs;
+    static constexpr const char *functionName = "clGetDeviceIDs";
+
     void enter(cl_platform_id *platform,
                cl_device_type *deviceType,
                cl_uint *numEntries,
@@ -4416,6 +4600,9 @@ class ClGetDeviceInfoTracer {
   public:
     ClGetDeviceInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetDeviceInfo;
+    static constexpr const char *functionName = "clGetDeviceInfo";
+
     void enter(cl_device_id *device,
                cl_device_info *paramName,
                size_t *paramValueSize,
@@ -4485,6 +4672,9 @@ class ClGetEventInfoTracer {
   public:
     ClGetEventInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetEventInfo;
+    static constexpr const char *functionName = "clGetEventInfo";
+
     void enter(cl_event *event,
                cl_event_info *paramName,
                size_t *paramValueSize,
@@ -4554,6 +4744,9 @@ class ClGetEventProfilingInfoTracer {
   public:
     ClGetEventProfilingInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetEventProfilingInfo;
+    static constexpr const char *functionName = "clGetEventProfilingInfo";
+
     void enter(cl_event *event,
                cl_profiling_info *paramName,
                size_t *paramValueSize,
@@ -4623,6 +4816,9 @@ class ClGetExtensionFunctionAddressTracer {
   public:
     ClGetExtensionFunctionAddressTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetExtensionFunctionAddress;
+    static constexpr const char *functionName = "clGetExtensionFunctionAddress";
+
     void enter(const char **funcName) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -4684,6 +4880,9 @@ class ClGetExtensionFunctionAddressForPlatformTracer {
   public:
     ClGetExtensionFunctionAddressForPlatformTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetExtensionFunctionAddressForPlatform;
+    static constexpr const char *functionName = "clGetExtensionFunctionAddressForPlatform";
+
     void enter(cl_platform_id *platform,
                const char **funcName) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -4747,6 +4946,9 @@ class ClGetHostTimerTracer {
   public:
     ClGetHostTimerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetHostTimer;
+    static constexpr const char *functionName = "clGetHostTimer";
+
     void enter(cl_device_id *device,
                cl_ulong **hostTimestamp) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -4810,6 +5012,9 @@ class ClGetImageInfoTracer {
   public:
     ClGetImageInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetImageInfo;
+    static constexpr const char *functionName = "clGetImageInfo";
+
     void enter(cl_mem *image,
                cl_image_info *paramName,
                size_t *paramValueSize,
@@ -4879,6 +5084,9 @@ class ClGetKernelArgInfoTracer {
   public:
     ClGetKernelArgInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetKernelArgInfo;
+    static constexpr const char *functionName = "clGetKernelArgInfo";
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndx,
                cl_kernel_arg_info *paramName,
@@ -4950,6 +5158,9 @@ class ClGetKernelInfoTracer {
   public:
     ClGetKernelInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetKernelInfo;
+    static constexpr const char *functionName = "clGetKernelInfo";
+
     void enter(cl_kernel *kernel,
                cl_kernel_info *paramName,
                size_t *paramValueSize,
@@ -5019,6 +5230,9 @@ class ClGetKernelSubGroupInfoTracer {
   public:
     ClGetKernelSubGroupInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetKernelSubGroupInfo;
+    static constexpr const char *functionName = "clGetKernelSubGroupInfo";
+
     void enter(cl_kernel *kernel,
                cl_device_id *device,
                cl_kernel_sub_group_info *paramName,
@@ -5094,6 +5308,9 @@ class ClGetKernelWorkGroupInfoTracer {
   public:
     ClGetKernelWorkGroupInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetKernelWorkGroupInfo;
+    static constexpr const char *functionName = "clGetKernelWorkGroupInfo";
+
     void enter(cl_kernel *kernel,
                cl_device_id *device,
                cl_kernel_work_group_info *paramName,
@@ -5165,6 +5382,9 @@ class ClGetMemObjectInfoTracer {
   public:
     ClGetMemObjectInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetMemObjectInfo;
+    static constexpr const char *functionName = "clGetMemObjectInfo";
+
     void enter(cl_mem *memobj,
                cl_mem_info *paramName,
                size_t *paramValueSize,
@@ -5234,6 +5454,9 @@ class ClGetPipeInfoTracer {
   public:
     ClGetPipeInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetPipeInfo;
+    static constexpr const char *functionName = "clGetPipeInfo";
+
     void enter(cl_mem *pipe,
                cl_pipe_info *paramName,
                size_t *paramValueSize,
@@ -5303,6 +5526,9 @@ class ClGetPlatformIDsTracer {
   public:
     ClGetPlatformIDsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetPlatformIDs;
+    static constexpr const char *functionName = "clGetPlatformIDs";
+
     void enter(cl_uint *numEntries,
                cl_platform_id **platforms,
                cl_uint **numPlatforms) {
@@ -5368,6 +5594,9 @@ class ClGetPlatformInfoTracer {
   public:
     ClGetPlatformInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetPlatformInfo;
+    static constexpr const char *functionName = "clGetPlatformInfo";
+
     void enter(cl_platform_id *platform,
                cl_platform_info *paramName,
                size_t *paramValueSize,
@@ -5437,6 +5666,9 @@ class ClGetProgramBuildInfoTracer {
   public:
     ClGetProgramBuildInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetProgramBuildInfo;
+    static constexpr const char *functionName = "clGetProgramBuildInfo";
+
     void enter(cl_program *program,
                cl_device_id *device,
                cl_program_build_info *paramName,
@@ -5508,6 +5740,9 @@ class ClGetProgramInfoTracer {
   public:
     ClGetProgramInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetProgramInfo;
+    static constexpr const char *functionName = "clGetProgramInfo";
+
     void enter(cl_program *program,
                cl_program_info *paramName,
                size_t *paramValueSize,
@@ -5577,6 +5812,9 @@ class ClGetSamplerInfoTracer {
   public:
     ClGetSamplerInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetSamplerInfo;
+    static constexpr const char *functionName = "clGetSamplerInfo";
+
     void enter(cl_sampler *sampler,
                cl_sampler_info *paramName,
                size_t *paramValueSize,
@@ -5646,6 +5884,9 @@ class ClGetSupportedImageFormatsTracer {
   public:
     ClGetSupportedImageFormatsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetSupportedImageFormats;
+    static constexpr const char *functionName = "clGetSupportedImageFormats";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_mem_object_type *imageType,
@@ -5717,6 +5958,9 @@ class ClLinkProgramTracer {
   public:
     ClLinkProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clLinkProgram;
+    static constexpr const char *functionName = "clLinkProgram";
+
     void enter(cl_context *context,
                cl_uint *numDevices,
                const cl_device_id **deviceList,
@@ -5794,6 +6038,9 @@ class ClReleaseCommandQueueTracer {
   public:
     ClReleaseCommandQueueTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseCommandQueue;
+    static constexpr const char *functionName = "clReleaseCommandQueue";
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5855,6 +6102,9 @@ class ClReleaseContextTracer {
   public:
     ClReleaseContextTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseContext;
+    static constexpr const char *functionName = "clReleaseContext";
+
     void enter(cl_context *context) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5916,6 +6166,9 @@ class ClReleaseDeviceTracer {
   public:
     ClReleaseDeviceTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseDevice;
+    static constexpr const char *functionName = "clReleaseDevice";
+
     void enter(cl_device_id *device) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -5977,6 +6230,9 @@ class ClReleaseEventTracer {
   public:
     ClReleaseEventTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseEvent;
+    static constexpr const char *functionName = "clReleaseEvent";
+
     void enter(cl_event *event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6038,6 +6294,9 @@ class ClReleaseKernelTracer {
   public:
     ClReleaseKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseKernel;
+    static constexpr const char *functionName = "clReleaseKernel";
+
     void enter(cl_kernel *kernel) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6099,6 +6358,9 @@ class ClReleaseMemObjectTracer {
   public:
     ClReleaseMemObjectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseMemObject;
+    static constexpr const char *functionName = "clReleaseMemObject";
+
     void enter(cl_mem *memobj) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6160,6 +6422,9 @@ class ClReleaseProgramTracer {
   public:
     ClReleaseProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseProgram;
+    static constexpr const char *functionName = "clReleaseProgram";
+
     void enter(cl_program *program) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6221,6 +6486,9 @@ class ClReleaseSamplerTracer {
   public:
     ClReleaseSamplerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clReleaseSampler;
+    static constexpr const char *functionName = "clReleaseSampler";
+
     void enter(cl_sampler *sampler) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6282,6 +6550,9 @@ class ClRetainCommandQueueTracer {
   public:
     ClRetainCommandQueueTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainCommandQueue;
+    static constexpr const char *functionName = "clRetainCommandQueue";
+
     void enter(cl_command_queue *commandQueue) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6343,6 +6614,9 @@ class ClRetainContextTracer {
   public:
     ClRetainContextTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainContext;
+    static constexpr const char *functionName = "clRetainContext";
+
     void enter(cl_context *context) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6404,6 +6678,9 @@ class ClRetainDeviceTracer {
   public:
     ClRetainDeviceTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainDevice;
+    static constexpr const char *functionName = "clRetainDevice";
+
     void enter(cl_device_id *device) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6465,6 +6742,9 @@ class ClRetainEventTracer {
   public:
     ClRetainEventTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainEvent;
+    static constexpr const char *functionName = "clRetainEvent";
+
     void enter(cl_event *event) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6526,6 +6806,9 @@ class ClRetainKernelTracer {
   public:
     ClRetainKernelTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainKernel;
+    static constexpr const char *functionName = "clRetainKernel";
+
     void enter(cl_kernel *kernel) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6587,6 +6870,9 @@ class ClRetainMemObjectTracer {
   public:
     ClRetainMemObjectTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainMemObject;
+    static constexpr const char *functionName = "clRetainMemObject";
+
     void enter(cl_mem *memobj) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6648,6 +6934,9 @@ class ClRetainProgramTracer {
   public:
     ClRetainProgramTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainProgram;
+    static constexpr const char *functionName = "clRetainProgram";
+
     void enter(cl_program *program) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6709,6 +6998,9 @@ class ClRetainSamplerTracer {
   public:
     ClRetainSamplerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clRetainSampler;
+    static constexpr const char *functionName = "clRetainSampler";
+
     void enter(cl_sampler *sampler) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -6770,6 +7062,9 @@ class ClSvmAllocTracer {
   public:
     ClSvmAllocTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSVMAlloc;
+    static constexpr const char *functionName = "clSVMAlloc";
+
     void enter(cl_context *context,
                cl_svm_mem_flags *flags,
                size_t *size,
@@ -6837,6 +7132,9 @@ class ClSvmFreeTracer {
   public:
     ClSvmFreeTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSVMFree;
+    static constexpr const char *functionName = "clSVMFree";
+
     void enter(cl_context *context,
                void **svmPointer) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -6900,6 +7198,9 @@ class ClSetCommandQueuePropertyTracer {
   public:
     ClSetCommandQueuePropertyTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetCommandQueueProperty;
+    static constexpr const char *functionName = "clSetCommandQueueProperty";
+
     void enter(cl_command_queue *commandQueue,
                cl_command_queue_properties *properties,
                cl_bool *enable,
@@ -6967,6 +7268,9 @@ class ClSetDefaultDeviceCommandQueueTracer {
   public:
     ClSetDefaultDeviceCommandQueueTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetDefaultDeviceCommandQueue;
+    static constexpr const char *functionName = "clSetDefaultDeviceCommandQueue";
+
     void enter(cl_context *context,
                cl_device_id *device,
                cl_command_queue *commandQueue) {
@@ -7032,6 +7336,9 @@ class ClSetEventCallbackTracer {
   public:
     ClSetEventCallbackTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetEventCallback;
+    static constexpr const char *functionName = "clSetEventCallback";
+
     void enter(cl_event *event,
                cl_int *commandExecCallbackType,
                void(CL_CALLBACK **funcNotify)(cl_event, cl_int, void *),
@@ -7099,6 +7406,9 @@ class ClSetKernelArgTracer {
   public:
     ClSetKernelArgTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetKernelArg;
+    static constexpr const char *functionName = "clSetKernelArg";
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndex,
                size_t *argSize,
@@ -7166,6 +7476,9 @@ class ClSetKernelArgSvmPointerTracer {
   public:
     ClSetKernelArgSvmPointerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetKernelArgSVMPointer;
+    static constexpr const char *functionName = "clSetKernelArgSVMPointer";
+
     void enter(cl_kernel *kernel,
                cl_uint *argIndex,
                const void **argValue) {
@@ -7231,6 +7544,9 @@ class ClSetKernelExecInfoTracer {
   public:
     ClSetKernelExecInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetKernelExecInfo;
+    static constexpr const char *functionName = "clSetKernelExecInfo";
+
     void enter(cl_kernel *kernel,
                cl_kernel_exec_info *paramName,
                size_t *paramValueSize,
@@ -7298,6 +7614,9 @@ class ClSetMemObjectDestructorCallbackTracer {
   public:
     ClSetMemObjectDestructorCallbackTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetMemObjectDestructorCallback;
+    static constexpr const char *functionName = "clSetMemObjectDestructorCallback";
+
     void enter(cl_mem *memobj,
                void(CL_CALLBACK **funcNotify)(cl_mem, void *),
                void **userData) {
@@ -7363,6 +7682,9 @@ class ClSetUserEventStatusTracer {
   public:
     ClSetUserEventStatusTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clSetUserEventStatus;
+    static constexpr const char *functionName = "clSetUserEventStatus";
+
     void enter(cl_event *event,
                cl_int *executionStatus) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -7426,6 +7748,9 @@ class ClUnloadCompilerTracer {
   public:
     ClUnloadCompilerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clUnloadCompiler;
+    static constexpr const char *functionName = "clUnloadCompiler";
+
     void enter() {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -7484,6 +7809,9 @@ class ClUnloadPlatformCompilerTracer {
   public:
     ClUnloadPlatformCompilerTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clUnloadPlatformCompiler;
+    static constexpr const char *functionName = "clUnloadPlatformCompiler";
+
     void enter(cl_platform_id *platform) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
 
@@ -7545,6 +7873,9 @@ class ClWaitForEventsTracer {
   public:
     ClWaitForEventsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clWaitForEvents;
+    static constexpr const char *functionName = "clWaitForEvents";
+
     void enter(cl_uint *numEvents,
                const cl_event **eventList) {
         DEBUG_BREAK_IF(state != TRACING_NOTIFY_STATE_NOTHING_CALLED);
@@ -7608,6 +7939,9 @@ class ClCreateFromGlBufferTracer {
   public:
     ClCreateFromGlBufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateFromGLBuffer;
+    static constexpr const char *functionName = "clCreateFromGLBuffer";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLuint *bufobj,
@@ -7675,6 +8009,9 @@ class ClCreateFromGlRenderbufferTracer {
   public:
     ClCreateFromGlRenderbufferTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateFromGLRenderbuffer;
+    static constexpr const char *functionName = "clCreateFromGLRenderbuffer";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLuint *renderbuffer,
@@ -7742,6 +8079,9 @@ class ClCreateFromGlTextureTracer {
   public:
     ClCreateFromGlTextureTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateFromGLTexture;
+    static constexpr const char *functionName = "clCreateFromGLTexture";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7813,6 +8153,9 @@ class ClCreateFromGlTexture2DTracer {
   public:
     ClCreateFromGlTexture2DTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateFromGLTexture2D;
+    static constexpr const char *functionName = "clCreateFromGLTexture2D";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7884,6 +8227,9 @@ class ClCreateFromGlTexture3DTracer {
   public:
     ClCreateFromGlTexture3DTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clCreateFromGLTexture3D;
+    static constexpr const char *functionName = "clCreateFromGLTexture3D";
+
     void enter(cl_context *context,
                cl_mem_flags *flags,
                cl_GLenum *target,
@@ -7955,6 +8301,9 @@ class ClEnqueueAcquireGlObjectsTracer {
   public:
     ClEnqueueAcquireGlObjectsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueAcquireGLObjects;
+    static constexpr const char *functionName = "clEnqueueAcquireGLObjects";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numObjects,
                const cl_mem **memObjects,
@@ -8026,6 +8375,9 @@ class ClEnqueueReleaseGlObjectsTracer {
   public:
     ClEnqueueReleaseGlObjectsTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clEnqueueReleaseGLObjects;
+    static constexpr const char *functionName = "clEnqueueReleaseGLObjects";
+
     void enter(cl_command_queue *commandQueue,
                cl_uint *numObjects,
                const cl_mem **memObjects,
@@ -8097,6 +8449,9 @@ class ClGetGlObjectInfoTracer {
   public:
     ClGetGlObjectInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetGLObjectInfo;
+    static constexpr const char *functionName = "clGetGLObjectInfo";
+
     void enter(cl_mem *memobj,
                cl_gl_object_type **glObjectType,
                cl_GLuint **glObjectName) {
@@ -8162,6 +8517,9 @@ class ClGetGlTextureInfoTracer {
   public:
     ClGetGlTextureInfoTracer() {}
 
+    static constexpr ClFunctionId functionId = CL_FUNCTION_clGetGLTextureInfo;
+    static constexpr const char *functionName = "clGetGLTextureInfo";
+
     void enter(cl_mem *memobj,
                cl_gl_texture_info *paramName,
                size_t *paramValueSize,
@@ -1,15 +1,22 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/api_binary_tracer.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
 #include "opencl/source/tracing/tracing_api.h"
+#include "opencl/source/tracing/tracing_builtin.h"
 #include "opencl/source/tracing/tracing_notify.h"
 #include "opencl/test/unit_test/api/cl_api_tests.h"
 #include "opencl/test/unit_test/fixtures/platform_fixture.h"
 
+#include <sstream>
+
 using namespace NEO;
 
 namespace ULT {
@@ -218,6 +225,106 @@ TEST_F(IntelTracingTest, GivenTwoHandlesWhenCallingTracingFunctionsThenSuccessIs
     EXPECT_EQ(CL_SUCCESS, status);
 }
 
+TEST_F(IntelTracingTest, givenDefaultFlagsWhenCreatingBuiltinTracerThenNoTracerIsCreated) {
+    EXPECT_EQ(nullptr, HostSideTracing::BuiltinTracer::create());
+}
+
+TEST_F(IntelTracingTest, givenPrintClApiStatisticsWhenCreatingBuiltinTracerThenOnlyStatisticsAreCollected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintClApiStatistics.set(true);
+
+    auto builtinTracer = HostSideTracing::BuiltinTracer::create();
+    ASSERT_NE(nullptr, builtinTracer);
+    EXPECT_NE(nullptr, builtinTracer->apiStatistics);
+    EXPECT_EQ(nullptr, builtinTracer->binaryTracer);
+    builtinTracer->apiStatistics.reset();
+}
+
+TEST_F(IntelTracingTest, givenBuiltinTracerWhenCallingApiFunctionThenCallIsStoredInBinaryTraceAndStatistics) {
+    std::stringstream traceOutput;
+    auto builtinTracer = std::make_unique<HostSideTracing::BuiltinTracer>();
+    builtinTracer->binaryTracer = std::make_unique<NEO::ApiBinaryTracer>(traceOutput);
+    builtinTracer->apiStatistics = std::make_unique<HostSideTracing::ApiStatistics>();
+    VariableBackup<HostSideTracing::BuiltinTracer *> builtinTracerBackup(&HostSideTracing::pGlobalBuiltinTracer, builtinTracer.get());
+
+    cl_context context = pContext;
+    cl_uint referenceCount = 0;
+    retVal = clGetContextInfo(context, CL_CONTEXT_REFERENCE_COUNT, sizeof(referenceCount), &referenceCount, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    retVal = clGetContextInfo(nullptr, CL_CONTEXT_REFERENCE_COUNT, sizeof(referenceCount), &referenceCount, nullptr);
+    EXPECT_EQ(CL_INVALID_CONTEXT, retVal);
+
+    auto &statistics = builtinTracer->apiStatistics->functions[CL_FUNCTION_clGetContextInfo];
+    EXPECT_STREQ("clGetContextInfo", statistics.name.load());
+    EXPECT_EQ(2u, statistics.callCount.load());
+    uint64_t histogramCount = 0;
+    for (auto &bucket : statistics.histogram) {
+        histogramCount += bucket.load();
+    }
+    EXPECT_EQ(2u, histogramCount);
+    EXPECT_NE(std::string::npos, builtinTracer->apiStatistics->toString().find("clGetContextInfo calls: 2"));
+    builtinTracer->apiStatistics.reset();
+
+    builtinTracer->binaryTracer.reset();
+    auto trace = traceOutput.str();
+    ASSERT_EQ(sizeof(NEO::ApiBinaryTraceFileHeader) + 2 * sizeof(NEO::ApiBinaryTraceRecord), trace.size());
+
+    NEO::ApiBinaryTraceRecord records[2];
+    memcpy(records, trace.data() + sizeof(NEO::ApiBinaryTraceFileHeader), sizeof(records));
+    EXPECT_EQ(static_cast<uint64_t>(CL_FUNCTION_clGetContextInfo), records[0].apiId);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(context), records[0].handle);
+    EXPECT_EQ(CL_SUCCESS, records[0].result);
+    EXPECT_LE(records[0].startTimestamp, records[0].endTimestamp);
+    EXPECT_EQ(static_cast<uint64_t>(CL_FUNCTION_clGetContextInfo), records[1].apiId);
+    EXPECT_EQ(0u, records[1].handle);
+    EXPECT_EQ(CL_INVALID_CONTEXT, records[1].result);
+    EXPECT_LE(records[0].endTimestamp, records[1].startTimestamp);
+}
+
+TEST_F(IntelTracingTest, givenBuiltinTracerWhenCreateCallFailsThenErrcodeRetIsStoredAsResult) {
+    std::stringstream traceOutput;
+    auto builtinTracer = std::make_unique<HostSideTracing::BuiltinTracer>();
+    builtinTracer->binaryTracer = std::make_unique<NEO::ApiBinaryTracer>(traceOutput);
+    VariableBackup<HostSideTracing::BuiltinTracer *> builtinTracerBackup(&HostSideTracing::pGlobalBuiltinTracer, builtinTracer.get());
+
+    EXPECT_EQ(nullptr, clCreateBuffer(nullptr, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_CONTEXT, retVal);
+    EXPECT_EQ(nullptr, clCreateBuffer(nullptr, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, nullptr));
+
+    builtinTracer->binaryTracer.reset();
+    auto trace = traceOutput.str();
+    ASSERT_EQ(sizeof(NEO::ApiBinaryTraceFileHeader) + 2 * sizeof(NEO::ApiBinaryTraceRecord), trace.size());
+
+    NEO::ApiBinaryTraceRecord records[2];
+    memcpy(records, trace.data() + sizeof(NEO::ApiBinaryTraceFileHeader), sizeof(records));
+    EXPECT_EQ(static_cast<uint64_t>(CL_FUNCTION_clCreateBuffer), records[0].apiId);
+    EXPECT_EQ(CL_INVALID_CONTEXT, records[0].result);
+    EXPECT_EQ(static_cast<uint64_t>(CL_FUNCTION_clCreateBuffer), records[1].apiId);
+    EXPECT_EQ(NEO::ApiBinaryTraceRecord::noResult, records[1].result);
+}
+
+TEST_F(IntelTracingTest, givenBuiltinTraceScopeLeftWithoutExitWhenScopeEndsThenCallIsStoredAndTracingInProgressIsCleared) {
+    std::stringstream traceOutput;
+    auto builtinTracer = std::make_unique<HostSideTracing::BuiltinTracer>();
+    builtinTracer->binaryTracer = std::make_unique<NEO::ApiBinaryTracer>(traceOutput);
+    VariableBackup<HostSideTracing::BuiltinTracer *> builtinTracerBackup(&HostSideTracing::pGlobalBuiltinTracer, builtinTracer.get());
+
+    {
+        HostSideTracing::BuiltinTraceScope<HostSideTracing::ClUnloadCompilerTracer> builtinTraceScope{};
+        EXPECT_TRUE(HostSideTracing::builtinTracingInProgress);
+    }
+    EXPECT_FALSE(HostSideTracing::builtinTracingInProgress);
+
+    builtinTracer->binaryTracer.reset();
+    auto trace = traceOutput.str();
+    ASSERT_EQ(sizeof(NEO::ApiBinaryTraceFileHeader) + sizeof(NEO::ApiBinaryTraceRecord), trace.size());
+
+    NEO::ApiBinaryTraceRecord record;
+    memcpy(&record, trace.data() + sizeof(NEO::ApiBinaryTraceFileHeader), sizeof(record));
+    EXPECT_EQ(static_cast<uint64_t>(CL_FUNCTION_clUnloadCompiler), record.apiId);
+    EXPECT_EQ(NEO::ApiBinaryTraceRecord::noResult, record.result);
+}
+
 struct IntelAllTracingTest : public IntelTracingTest {
   public:
     IntelAllTracingTest() {}
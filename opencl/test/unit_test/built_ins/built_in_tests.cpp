@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1508,12 +1508,27 @@ TEST_F(BuiltInTests, GivenFileNameWhenGettingKernelFromEmbeddedStorageRegistryTh
     std::string resource = "__kernel";
     storageRegistry.store("kernel.cl", createBuiltinResource(resource.data(), resource.size() + 1));
 
-    const BuiltinResourceT *br = storageRegistry.get("kernel.cl");
-    EXPECT_NE(nullptr, br);
-    EXPECT_EQ(0, strcmp(resource.data(), br->data()));
+    auto br = storageRegistry.get("kernel.cl");
+    EXPECT_FALSE(br.empty());
+    EXPECT_EQ(0, strcmp(resource.data(), br.begin()));
 
-    const BuiltinResourceT *bnr = storageRegistry.get("unknown.cl");
-    EXPECT_EQ(nullptr, bnr);
+    auto bnr = storageRegistry.get("unknown.cl");
+    EXPECT_TRUE(bnr.empty());
+}
+
+TEST_F(BuiltInTests, GivenEmbeddedArrayWhenStoringInEmbeddedStorageRegistryThenArrayIsReferencedWithoutCopy) {
+    class MockEmbeddedStorageRegistry : public EmbeddedStorageRegistry {
+        using EmbeddedStorageRegistry::EmbeddedStorageRegistry;
+    };
+    MockEmbeddedStorageRegistry storageRegistry;
+
+    static const char embeddedResource[] = "__kernel";
+    storageRegistry.store("kernel.bin", ArrayRef<const char>(embeddedResource, sizeof(embeddedResource)));
+    storageRegistry.store("kernel.bin", createBuiltinResource("__other", 8u));
+
+    auto resource = storageRegistry.get("kernel.bin");
+    EXPECT_EQ(embeddedResource, resource.begin());
+    EXPECT_EQ(sizeof(embeddedResource), resource.size());
 }
 
 TEST_F(BuiltInTests, WhenStoringRootPathThenPathIsSavedCorrectly) {
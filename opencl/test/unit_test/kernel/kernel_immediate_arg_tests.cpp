@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -365,3 +365,56 @@ TYPED_TEST(KernelArgImmediateTest, givenMultiplePatchesAndOneSourceOffsetBeyondA
         EXPECT_EQ(CL_SUCCESS, retVal);
     }
 }
+
+TYPED_TEST(KernelArgImmediateTest, givenArgNotSetWhenCheckingIfImmediateArgIsUnchangedThenReturnFalse) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(0, sizeof(TypeParam), &val));
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenArgSetWhenCheckingIfImmediateArgIsUnchangedThenReturnTrueOnlyForSameValueAndSize) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    auto otherVal = (TypeParam)0x55555555ULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(3, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        EXPECT_TRUE(pKernel->isImmediateArgUnchanged(3, sizeof(TypeParam), &val));
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(3, sizeof(TypeParam), &otherVal));
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(3, sizeof(TypeParam) + 1, &val));
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(3, sizeof(TypeParam), nullptr));
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(0, sizeof(TypeParam), &val));
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenArgSetWithCustomHandlerWhenCheckingIfImmediateArgIsUnchangedThenReturnFalse) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        pKernel->setKernelArgHandler(0, &Kernel::setArgLocal);
+        EXPECT_FALSE(pKernel->isImmediateArgUnchanged(0, sizeof(TypeParam), &val));
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenArgSetWhenSettingSameValueAgainThenCrossThreadDataIsNotRewritten) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pKernel[rootDeviceIndex];
+        auto patchedArgumentsNum = pKernel->getPatchedArgumentsNum();
+
+        auto pKernelArg = reinterpret_cast<TypeParam *>(pKernel->getCrossThreadData() +
+                                                        this->pKernelInfo->argAsVal(0).elements[0].offset);
+        EXPECT_EQ(val, *pKernelArg);
+
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(TypeParam), &val));
+        EXPECT_EQ(val, *pKernelArg);
+        EXPECT_EQ(patchedArgumentsNum, pKernel->getPatchedArgumentsNum());
+        EXPECT_TRUE(pKernel->getKernelArgInfo(0).isPatched);
+    }
+}
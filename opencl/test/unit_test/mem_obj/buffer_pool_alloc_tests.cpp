@@ -449,6 +449,89 @@ TEST_F(AggregatedSmallBuffersKernelTest, givenBufferFromPoolWhenOffsetSubbufferI
     EXPECT_EQ(reinterpret_cast<void *>(gpuAddress + region.origin + buffer->getOffset()), *pKernelArg);
 }
 
+using AggregatedSmallBuffersTiersTest = AggregatedSmallBuffersTestTemplate<1, false, false>;
+
+TEST_F(AggregatedSmallBuffersTiersTest, givenDefaultTiersWhenPoolInitializedThenOnlySmallBuffersTierIsUsed) {
+    setUpImpl();
+    ASSERT_EQ(1u, poolAllocator->poolTiers.size());
+    EXPECT_EQ(PoolAllocator::smallBufferThreshold, poolAllocator->poolTiers[0].maxBufferSize);
+    EXPECT_EQ(PoolAllocator::aggregatedSmallBuffersPoolSize, poolAllocator->poolTiers[0].poolSize);
+    EXPECT_FALSE(poolAllocator->drainOnFree);
+}
+
+TEST_F(AggregatedSmallBuffersTiersTest, givenMultipleTiersEnabledWhenCreatingBufferAboveSmallBufferThresholdThenPoolOfMatchingTierIsCreatedOnDemand) {
+    debugManager.flags.ExperimentalSmallBufferPoolAllocatorTiers.set(3);
+    setUpImpl();
+    ASSERT_EQ(3u, poolAllocator->poolTiers.size());
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].tierIndex);
+
+    size = PoolAllocator::poolTiersDefinitions[1].maxBufferSize;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(1u, poolAllocator->bufferPools[1].tierIndex);
+    EXPECT_EQ(PoolAllocator::poolTiersDefinitions[1].poolSize, poolAllocator->bufferPools[1].mainStorage->getSize());
+    auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
+    EXPECT_TRUE(mockBuffer->isSubBuffer());
+    EXPECT_EQ(mockBuffer->associatedMemObject, poolAllocator->bufferPools[1].mainStorage.get());
+
+    std::unique_ptr<Buffer> secondBuffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(2 * size, poolAllocator->bufferPools[1].chunkAllocator->getUsedSize());
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+
+    auto statistics = poolAllocator->getPoolTierStatistics(1u);
+    EXPECT_EQ(1u, statistics.poolHits);
+    EXPECT_EQ(1u, statistics.poolMisses);
+    statistics = poolAllocator->getPoolTierStatistics(0u);
+    EXPECT_EQ(0u, statistics.poolHits);
+    EXPECT_EQ(0u, statistics.poolMisses);
+
+    size = PoolAllocator::poolTiersDefinitions[2].maxBufferSize + 1;
+    std::unique_ptr<Buffer> notPooledBuffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, notPooledBuffer);
+    EXPECT_FALSE(notPooledBuffer->isSubBuffer());
+    EXPECT_EQ(2u, poolAllocator->bufferPools.size());
+}
+
+TEST_F(AggregatedSmallBuffersTiersTest, givenTiersCountAboveSupportedWhenPoolInitializedThenTiersCountIsClamped) {
+    debugManager.flags.ExperimentalSmallBufferPoolAllocatorTiers.set(10);
+    setUpImpl();
+    EXPECT_EQ(PoolAllocator::maxPoolTiersCount, poolAllocator->poolTiers.size());
+}
+
+TEST_F(AggregatedSmallBuffersTiersTest, givenDrainOnFreeEnabledWhenBufferFromPoolIsReleasedAndPoolIsNotInUseThenChunkIsReturnedToPoolImmediately) {
+    debugManager.flags.ExperimentalSmallBufferPoolAllocatorDrainOnFree.set(1);
+    setUpImpl();
+    EXPECT_TRUE(poolAllocator->drainOnFree);
+    mockMemoryManager->deferAllocInUse = false;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(size, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+
+    buffer.reset();
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_TRUE(poolAllocator->bufferPools[0].chunksToFree.empty());
+}
+
+TEST_F(AggregatedSmallBuffersTiersTest, givenDrainOnFreeEnabledWhenBufferFromPoolIsReleasedAndPoolIsInUseThenChunkIsNotReturnedToPool) {
+    debugManager.flags.ExperimentalSmallBufferPoolAllocatorDrainOnFree.set(1);
+    setUpImpl();
+    mockMemoryManager->deferAllocInUse = true;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    buffer.reset();
+    EXPECT_EQ(size, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(1u, poolAllocator->bufferPools[0].chunksToFree.size());
+}
+
 using AggregatedSmallBuffersEnabledTestFailPoolInit = AggregatedSmallBuffersTestTemplate<1, true>;
 
 TEST_F(AggregatedSmallBuffersEnabledTestFailPoolInit, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledButPoolCreateFailedThenDoNotUsePool) {
@@ -1,19 +1,25 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
 #include "opencl/source/command_queue/command_queue.h"
+#include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
 
 #include "gtest/gtest.h"
 
@@ -136,3 +142,128 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenAllowCPUMemoryEvictionIs
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+struct ChunkedPageFaultManager : public MockPageFaultManager {
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        PageFaultManager::transferToCpu(ptr, size, cmdQ);
+    }
+    void transferRangeToGpu(void *ptr, size_t size, void *cmdQ) override {
+        PageFaultManager::transferRangeToGpu(ptr, size, cmdQ);
+    }
+    void releaseCleanRange(void *ptr, size_t size, void *cmdQ) override {
+        PageFaultManager::releaseCleanRange(ptr, size, cmdQ);
+    }
+};
+
+template <typename GfxFamily>
+struct SvmMapCopyTrackingCommandQueue : public MockCommandQueueHw<GfxFamily> {
+    using BaseClass = MockCommandQueueHw<GfxFamily>;
+    using BaseClass::BaseClass;
+
+    cl_int enqueueSVMMap(cl_bool blockingMap, cl_map_flags mapFlags,
+                         void *svmPtr, size_t size,
+                         cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                         cl_event *event, bool externalAppCall) override {
+        if (this->context->getSVMAllocsManager()->getSvmMapOperation(svmPtr) == nullptr) {
+            mapCopies.push_back({svmPtr, size});
+        }
+        return BaseClass::enqueueSVMMap(blockingMap, mapFlags, svmPtr, size, numEventsInWaitList, eventWaitList, event, externalAppCall);
+    }
+    cl_int enqueueSVMUnmap(void *svmPtr,
+                           cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                           cl_event *event, bool externalAppCall) override {
+        auto svmOperation = this->context->getSVMAllocsManager()->getSvmMapOperation(svmPtr);
+        if (svmOperation && !svmOperation->readOnlyMap) {
+            unmapCopies.push_back({svmPtr, svmOperation->regionSize});
+        }
+        return BaseClass::enqueueSVMUnmap(svmPtr, numEventsInWaitList, eventWaitList, event, externalAppCall);
+    }
+
+    std::vector<std::pair<void *, size_t>> mapCopies;
+    std::vector<std::pair<void *, size_t>> unmapCopies;
+};
+
+struct PageFaultManagerChunkedMigrationTest : public ClDeviceFixture,
+                                              public ::testing::Test {
+    void SetUp() override {
+        REQUIRE_SVM_OR_SKIP(defaultHwInfo);
+        dbgRestore = std::make_unique<DebugManagerStateRestore>();
+        debugManager.flags.EnableLocalMemory.set(1);
+        debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+        ClDeviceFixture::setUp();
+        context = std::make_unique<MockContext>(pClDevice, true);
+        svmPtr = context->getSVMAllocsManager()->createSVMAlloc(allocSize, {}, context->getRootDeviceIndices(), context->getDeviceBitfields());
+        ASSERT_NE(nullptr, svmPtr);
+        mockSvmManager = reinterpret_cast<MockSVMAllocsManager *>(context->getSVMAllocsManager());
+        pageFaultManager = std::make_unique<ChunkedPageFaultManager>();
+    }
+
+    void TearDown() override {
+        if (defaultHwInfo->capabilityTable.ftrSvm == false) {
+            return;
+        }
+        pageFaultManager.reset();
+        context->getSVMAllocsManager()->freeSVMAlloc(svmPtr);
+        context.reset();
+        ClDeviceFixture::tearDown();
+    }
+
+    void *chunk(size_t index) {
+        return ptrOffset(svmPtr, index * chunkSize);
+    }
+
+    const size_t chunkSize = 4 * MemoryConstants::kiloByte;
+    const size_t allocSize = 4 * chunkSize;
+    void *svmPtr = nullptr;
+    MockSVMAllocsManager *mockSvmManager = nullptr;
+    std::unique_ptr<ChunkedPageFaultManager> pageFaultManager;
+    std::unique_ptr<DebugManagerStateRestore> dbgRestore;
+    std::unique_ptr<MockContext> context;
+};
+
+HWTEST_F(PageFaultManagerChunkedMigrationTest, givenAdjacentDirtyChunksMappedSeparatelyWhenMovingToGpuDomainThenWholeRangeIsUnmappedAndNoMapOperationIsLeft) {
+    SvmMapCopyTrackingCommandQueue<FamilyType> queue(context.get(), pClDevice, nullptr);
+    pageFaultManager->insertAllocation(svmPtr, allocSize, mockSvmManager, &queue, {});
+    pageFaultManager->moveAllocationToGpuDomain(svmPtr);
+
+    pageFaultManager->verifyPageFault(chunk(0));
+    pageFaultManager->verifyPageFault(chunk(0));
+    pageFaultManager->verifyPageFault(chunk(1));
+    pageFaultManager->verifyPageFault(chunk(1));
+    pageFaultManager->verifyPageFault(chunk(3));
+    EXPECT_EQ(3u, queue.mapCopies.size());
+    EXPECT_EQ(3u, mockSvmManager->svmMapOperations.getNumMapOperations());
+
+    pageFaultManager->moveAllocationToGpuDomain(svmPtr);
+    ASSERT_EQ(1u, queue.unmapCopies.size());
+    EXPECT_EQ(chunk(0), queue.unmapCopies[0].first);
+    EXPECT_EQ(2 * chunkSize, queue.unmapCopies[0].second);
+    EXPECT_EQ(0u, mockSvmManager->svmMapOperations.getNumMapOperations());
+}
+
+HWTEST_F(PageFaultManagerChunkedMigrationTest, givenChunksMigratedBackToGpuWhenChunksFaultAgainThenDataIsCopiedToCpuAgain) {
+    SvmMapCopyTrackingCommandQueue<FamilyType> queue(context.get(), pClDevice, nullptr);
+    pageFaultManager->insertAllocation(svmPtr, allocSize, mockSvmManager, &queue, {});
+    pageFaultManager->moveAllocationToGpuDomain(svmPtr);
+
+    pageFaultManager->verifyPageFault(chunk(1));
+    pageFaultManager->verifyPageFault(chunk(1));
+    pageFaultManager->verifyPageFault(chunk(2));
+    pageFaultManager->verifyPageFault(chunk(2));
+    pageFaultManager->verifyPageFault(chunk(3));
+    pageFaultManager->moveAllocationToGpuDomain(svmPtr);
+    EXPECT_EQ(3u, queue.mapCopies.size());
+    EXPECT_EQ(0u, mockSvmManager->svmMapOperations.getNumMapOperations());
+
+    pageFaultManager->verifyPageFault(chunk(2));
+    pageFaultManager->verifyPageFault(chunk(3));
+    ASSERT_EQ(5u, queue.mapCopies.size());
+    EXPECT_EQ(chunk(2), queue.mapCopies[3].first);
+    EXPECT_EQ(chunkSize, queue.mapCopies[3].second);
+    EXPECT_EQ(chunk(3), queue.mapCopies[4].first);
+    EXPECT_EQ(chunkSize, queue.mapCopies[4].second);
+
+    pageFaultManager->moveAllocationToGpuDomain(svmPtr);
+    EXPECT_EQ(0u, mockSvmManager->svmMapOperations.getNumMapOperations());
+}
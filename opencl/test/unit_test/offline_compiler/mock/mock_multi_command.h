@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
 #include <optional>
 #include <string>
 
@@ -19,7 +20,9 @@ namespace NEO {
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::jobsCount;
     using MultiCommand::lines;
+    using MultiCommand::outputFile;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
@@ -49,9 +52,25 @@ class MockMultiCommand : public MultiCommand {
         return OCLOC_SUCCESS;
     }
 
+    int singleBuildJob(const std::vector<std::string> &args, OclocArgHelper *jobArgHelper, const std::string &jobOutFileName, std::ostream &jobOutputFile) override {
+        ++singleBuildJobCalledCount;
+
+        if (callBaseSingleBuild) {
+            return MultiCommand::singleBuildJob(args, jobArgHelper, jobOutFileName, jobOutputFile);
+        }
+
+        jobArgHelper->printf("Job for %s\n", jobOutFileName.c_str());
+        jobOutputFile << jobOutFileName << '\n';
+
+        auto buildId = std::stoul(jobOutFileName.substr(jobOutFileName.rfind('_') + 1)) - 1;
+        return buildId < singleBuildJobResults.size() ? singleBuildJobResults[buildId] : OCLOC_SUCCESS;
+    }
+
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
+    std::vector<int> singleBuildJobResults{};
     int singleBuildCalledCount{0};
+    std::atomic<int> singleBuildJobCalledCount{0};
     bool callBaseSingleBuild{true};
 };
 
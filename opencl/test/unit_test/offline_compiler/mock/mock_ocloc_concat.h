@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@ class MockOclocConcat : public OclocConcat {
     MockOclocConcat(OclocArgHelper *argHelper) : OclocConcat(argHelper){};
 
     using OclocConcat::checkIfFatBinariesExist;
+    using OclocConcat::deduplicate;
     using OclocConcat::fatBinaryName;
     using OclocConcat::fileNamesToConcat;
     using OclocConcat::parseArguments;
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/offline_compiler/source/ocloc_api.h"
+#include "shared/source/device_binary_format/ar/ar.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/test/common/mocks/mock_modules_zebin.h"
@@ -66,6 +67,23 @@ TEST(OclocConcatTest, GivenValidArgsWhenInitializingThenFileNamesToConcatAndOutp
     EXPECT_EQ(args[2], oclocConcat.fileNamesToConcat[0]);
     EXPECT_EQ(args[3], oclocConcat.fileNamesToConcat[1]);
     EXPECT_EQ(args[5], oclocConcat.fatBinaryName);
+    EXPECT_FALSE(oclocConcat.deduplicate);
+}
+
+TEST(OclocConcatTest, GivenDeduplicateBinariesArgWhenInitializingThenDeduplicationIsEnabled) {
+    MockOclocArgHelper::FilesMap mockArgHelperFilesMap{
+        {"fatBinary1.ar", "fatBinary1Data"},
+        {"fatBinary2.ar", "fatBinary2Data"}};
+    MockOclocArgHelper mockArgHelper{mockArgHelperFilesMap};
+    auto oclocConcat = MockOclocConcat(&mockArgHelper);
+    std::vector<std::string> args = {"ocloc", "concat", "fatBinary1.ar", "-deduplicate_binaries", "fatBinary2.ar"};
+
+    auto error = oclocConcat.initialize(args);
+    EXPECT_EQ(static_cast<uint32_t>(OCLOC_SUCCESS), error);
+    EXPECT_TRUE(oclocConcat.deduplicate);
+    ASSERT_EQ(2u, oclocConcat.fileNamesToConcat.size());
+    EXPECT_EQ(args[2], oclocConcat.fileNamesToConcat[0]);
+    EXPECT_EQ(args[4], oclocConcat.fileNamesToConcat[1]);
 }
 
 TEST(OclocConcatTest, GivenMissingOutFileNameAfterOutArgumentWhenInitalizingThenErrorIsReturned) {
@@ -177,4 +195,38 @@ TEST(OclocConcatTest, GivenZebinWithAOTNoteAndFatBinaryWhenConcatenatingThenCorr
     EXPECT_EQ("12.0.0", concatedAr.files[5].fileName);
 }
 
+TEST(OclocConcatTest, GivenFatBinaryWithIdenticalEntriesWhenConcatenatingThenOutputIsEqualToPlainArEncodingUnlessDeduplicationIsRequested) {
+    std::array<uint8_t, 32> file{0};
+    std::vector<uint8_t> fatBinary;
+    {
+        NEO::Ar::ArEncoder arEncoder(true);
+        arEncoder.appendFileEntry("10.0.0", ArrayRef<const uint8_t>::fromAny(file.data(), file.size()));
+        arEncoder.appendFileEntry("11.0.0", ArrayRef<const uint8_t>::fromAny(file.data(), file.size()));
+        fatBinary = arEncoder.encode();
+    }
+
+    MockOclocArgHelper::FilesMap mockArgHelperFilesMap{
+        {"fatBinary.ar", std::string(reinterpret_cast<const char *>(fatBinary.data()), fatBinary.size())}};
+    MockOclocArgHelper mockArgHelper{mockArgHelperFilesMap};
+    mockArgHelper.interceptOutput = true;
+    mockArgHelper.messagePrinter.setSuppressMessages(true);
+
+    auto oclocConcat = MockOclocConcat(&mockArgHelper);
+    oclocConcat.fileNamesToConcat = {"fatBinary.ar"};
+
+    auto error = oclocConcat.concatenate();
+    EXPECT_EQ(static_cast<uint32_t>(OCLOC_SUCCESS), error);
+    const auto defaultOutput = mockArgHelper.interceptedFiles["concat.ar"];
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(fatBinary.data()), fatBinary.size()), defaultOutput);
+    const auto aliasData = Ar::arFileEntryAliasMagic.str() + "10.0.0";
+    EXPECT_EQ(std::string::npos, defaultOutput.find(aliasData));
+
+    oclocConcat.deduplicate = true;
+    error = oclocConcat.concatenate();
+    EXPECT_EQ(static_cast<uint32_t>(OCLOC_SUCCESS), error);
+    const auto deduplicatedOutput = mockArgHelper.interceptedFiles["concat.ar"];
+    EXPECT_NE(std::string::npos, deduplicatedOutput.find(aliasData));
+    EXPECT_LT(deduplicatedOutput.size(), defaultOutput.size());
+}
+
 } // namespace NEO
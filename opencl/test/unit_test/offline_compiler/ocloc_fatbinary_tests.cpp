@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1674,6 +1674,39 @@ TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArch
     ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(expectedArchivePath));
 }
 
+TEST_F(OclocFatBinaryTest, givenJobsOptionAndTwoTargetsWhenBuildingFatbinaryThenArchiveIsTheSameAsForSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    mockArgHelper.setAllCallBase(true);
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-output_no_suffix",
+        "-device",
+        devices};
+
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
 TEST_F(OclocFatBinaryTest, givenSpirvInputAndExcludeIrFlagWhenFatBinaryIsRequestedThenArchiveDoesNotContainGenericIrFile) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -1954,6 +1987,27 @@ TEST(OclocFatBinaryHelpersTest, givenQuietModeWhenBuildingFatbinaryForTargetThen
     EXPECT_TRUE(output.empty()) << output;
 }
 
+TEST(OclocFatBinaryHelpersTest, givenIdenticalBinariesOfTwoTargetsWhenAppendingFatBinaryTargetsThenEntriesAreStoredAsIsUnlessDeduplicationIsRequested) {
+    MockOfflineCompiler mockOfflineCompiler{};
+    mockOfflineCompiler.elfBinary.assign(64, 0x5a);
+    const auto mockArgHelper = mockOfflineCompiler.uniqueHelper.get();
+    const std::string pointerSize{"64"};
+
+    Ar::ArEncoder expectedFatbinary(true);
+    expectedFatbinary.appendFileEntry(pointerSize + ".12.0.0", mockOfflineCompiler.elfBinary);
+    expectedFatbinary.appendFileEntry(pointerSize + ".12.1.0", mockOfflineCompiler.elfBinary);
+
+    Ar::ArEncoder defaultFatbinary(true);
+    appendFatBinaryTarget(pointerSize, defaultFatbinary, &mockOfflineCompiler, mockArgHelper, "12.0.0", false);
+    appendFatBinaryTarget(pointerSize, defaultFatbinary, &mockOfflineCompiler, mockArgHelper, "12.1.0", false);
+    EXPECT_EQ(expectedFatbinary.encode(), defaultFatbinary.encode());
+
+    Ar::ArEncoder deduplicatedFatbinary(true);
+    appendFatBinaryTarget(pointerSize, deduplicatedFatbinary, &mockOfflineCompiler, mockArgHelper, "12.0.0", true);
+    appendFatBinaryTarget(pointerSize, deduplicatedFatbinary, &mockOfflineCompiler, mockArgHelper, "12.1.0", true);
+    EXPECT_LT(deduplicatedFatbinary.encode().size(), expectedFatbinary.encode().size());
+}
+
 TEST_P(OclocFatbinaryPerProductTests, givenReleaseWhenGetTargetProductsForFarbinaryThenCorrectAcronymsAreReturned) {
     auto aotInfos = argHelper->productConfigHelper->getDeviceAotInfo();
     std::vector<NEO::ConstStringRef> expected{};
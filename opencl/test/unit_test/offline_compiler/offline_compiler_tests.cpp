@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -393,12 +393,84 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run in parallel.
+                                0 means one build per hardware thread.
+                                Logs and output file list are kept
+                                in the order of commands in <file_name>.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
     EXPECT_EQ(-1, result);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenJobsOptionWhenRunningBuildsThenBuildsAreRunInParallelJobsAndLogsAndResultsAreKeptInCommandsOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.jobsCount = 4;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.lines = {"-file a.cl -device x", "-file b.cl -device x", "-file c.cl -device x",
+                              "-file d.cl -device x", "-file e.cl -device x", "-file f.cl -device x"};
+    mockMultiCommand.singleBuildJobResults = {OCLOC_SUCCESS, OCLOC_INVALID_FILE, OCLOC_SUCCESS,
+                                              OCLOC_SUCCESS, OCLOC_BUILD_PROGRAM_FAILURE, OCLOC_SUCCESS};
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(6, mockMultiCommand.singleBuildJobCalledCount.load());
+    EXPECT_EQ(mockMultiCommand.singleBuildJobResults, mockMultiCommand.retValues);
+
+    std::string expectedOutput;
+    std::string expectedOutputFile;
+    for (size_t i = 0; i < mockMultiCommand.lines.size(); ++i) {
+        expectedOutput += "Command number " + std::to_string(i + 1) + ": \n";
+        expectedOutput += "Job for build_no_" + std::to_string(i + 1) + "\n";
+        expectedOutputFile += "build_no_" + std::to_string(i + 1) + "\n";
+    }
+    EXPECT_EQ(expectedOutput, output);
+    EXPECT_EQ(expectedOutputFile, mockMultiCommand.outputFile.str());
+}
+
+TEST(MultiCommandWhiteboxTest, GivenJobsOptionAndInvalidCommandLineWhenRunningBuildsThenOnlyValidCommandsAreBuiltAndErrorIsReportedForInvalidOne) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = true;
+    mockMultiCommand.jobsCount = 2;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.lines = {"-file a.cl -device x", "-file \"b.cl -device x", "-file c.cl -device x"};
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(2, mockMultiCommand.singleBuildJobCalledCount.load());
+    const std::vector<int> expectedRetValues = {OCLOC_SUCCESS, OCLOC_INVALID_FILE, OCLOC_SUCCESS};
+    EXPECT_EQ(expectedRetValues, mockMultiCommand.retValues);
+    EXPECT_EQ("One of the quotes is open in build number 2\nJob for build_no_1\nJob for build_no_3\n", output);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenJobsOptionWhenInitializingThenJobsCountIsParsed) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.filesMap["commands.txt"] = "-file a.cl -device x";
+    mockMultiCommand.callBaseSingleBuild = false;
+
+    std::vector<std::string> args = {"ocloc", "multi", "commands.txt", "-j", "3", "-q"};
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.initialize(args);
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(3u, mockMultiCommand.jobsCount);
+
+    args[4] = "0";
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.initialize(args);
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_LE(1u, mockMultiCommand.jobsCount);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenCommandLineWithApostrophesWhenSplittingLineInSeparateArgsThenTextBetweenApostrophesIsReadAsSingleArg) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.quiet = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,10 @@
 #include "gtest/gtest.h"
 #include "segfault_helper.h"
 
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 extern int generateSegfaultWithSafetyGuard(SegfaultHelper *segfaultHelper);
 
@@ -56,3 +59,38 @@ TEST(SegFault, givenCallWithSafetyGuardWhenSegfaultHappensThenCallstackIsPrinted
     GTEST_SKIP();
 #endif
 }
+
+std::atomic<uint32_t> segfaultsHandled{0u};
+
+void countHandledSegfault() {
+    segfaultsHandled++;
+}
+
+TEST(SegFault, givenCallsWithSafetyGuardOnManyThreadsWhenSegfaultsHappenThenEachCallReturnsItsRetValueOnCrash) {
+#if !defined(SKIP_SEGFAULT_TEST)
+    constexpr uint32_t threadsCount = 4u;
+    SegfaultHelper segfault;
+    segfault.segfaultHandlerCallback = countHandledSegfault;
+    segfaultsHandled = 0u;
+    std::atomic<uint32_t> crashedCalls{0u};
+
+    ::testing::internal::CaptureStdout();
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < threadsCount; i++) {
+        threads.emplace_back([&]() {
+            if (generateSegfaultWithSafetyGuard(&segfault) == -60) {
+                crashedCalls++;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ::testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(threadsCount, crashedCalls.load());
+    EXPECT_EQ(threadsCount, segfaultsHandled.load());
+#else
+    GTEST_SKIP();
+#endif
+}
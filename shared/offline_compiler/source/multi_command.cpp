@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,40 +14,50 @@
 #include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_jobs.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+    return buildSingleCommand(args, argHelper, outFileName, outputFile);
+}
+
+int MultiCommand::singleBuildJob(const std::vector<std::string> &args, OclocArgHelper *jobArgHelper, const std::string &jobOutFileName, std::ostream &jobOutputFile) {
+    return buildSingleCommand(args, jobArgHelper, jobOutFileName, jobOutputFile);
+}
+
+int MultiCommand::buildSingleCommand(const std::vector<std::string> &args, OclocArgHelper *helper, std::string buildOutFileName, std::ostream &buildOutputFile) {
     int retVal = OCLOC_SUCCESS;
 
-    if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
+    if (requestedFatBinary(args, helper)) {
+        retVal = buildFatBinary(args, helper);
     } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
+        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, helper)};
         if (retVal == OCLOC_SUCCESS) {
             retVal = buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
+                helper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        buildOutFileName += ".bin";
     }
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
-            argHelper->printf("Build succeeded.\n");
+            helper->printf("Build succeeded.\n");
     } else {
-        argHelper->printf("Build failed with error code: %d\n", retVal);
+        helper->printf("Build failed with error code: %d\n", retVal);
     }
 
     if (retVal == OCLOC_SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        buildOutputFile << getCurrentDirectoryOwn(outDirForBuilds) + buildOutFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        buildOutputFile << "Unsuccesful build";
     }
-    outputFile << '\n';
+    buildOutputFile << '\n';
 
     return retVal;
 }
@@ -109,6 +119,8 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            jobsCount = parseJobsCount(args[++argIndex]);
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -137,6 +149,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (jobsCount > 1 && lines.size() > 1 && !argHelper->outputEnabled()) {
+        runBuildsInParallel(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -156,6 +173,59 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct BuildJob {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::unique_ptr<OclocArgHelper> argHelper;
+        std::stringstream outputFile;
+        int retVal = OCLOC_SUCCESS;
+        bool silenceMessages = false;
+    };
+
+    std::vector<BuildJob> jobs(lines.size());
+    std::vector<size_t> jobsToRun;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &job = jobs[i];
+        job.args = {argZero};
+        job.retVal = splitLineInSeparateArgs(job.args, lines[i], i);
+        if (job.retVal != OCLOC_SUCCESS) {
+            continue;
+        }
+
+        addAdditionalOptionsToSingleCommandLine(job.args, i);
+        job.outFileName = outFileName;
+        job.silenceMessages = std::find(job.args.begin(), job.args.end(), "-qq") != job.args.end();
+
+        // each build logs into its own helper, logs are printed in commands order once all builds are done
+        job.argHelper = std::make_unique<OclocArgHelper>();
+        job.argHelper->getPrinterRef().setSuppressMessages(true);
+        jobsToRun.push_back(i);
+    }
+
+    runParallelJobs(jobsToRun.size(), jobsCount, [&](size_t index) {
+        auto &job = jobs[jobsToRun[index]];
+        job.retVal = singleBuildJob(job.args, job.argHelper.get(), job.outFileName, job.outputFile);
+    });
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto &job = jobs[i];
+        retValues.push_back(job.retVal);
+        if (job.argHelper == nullptr) {
+            continue;
+        }
+
+        if (!quiet) {
+            argHelper->printf("Command number %zu: \n", i + 1);
+        }
+        if (job.silenceMessages) {
+            argHelper->getPrinterRef().setSuppressMessages(true);
+        }
+        argHelper->printf(job.argHelper->getPrinterRef().getLog().str().c_str());
+        outputFile << job.outputFile.str();
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -171,6 +241,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run in parallel.
+                                0 means one build per hardware thread.
+                                Logs and output file list are kept
+                                in the order of commands in <file_name>.
+
 )===");
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,8 @@ OclocConcat::ErrorCode OclocConcat::parseArguments(const std::vector<std::string
                 return OCLOC_INVALID_COMMAND_LINE;
             }
             fatBinaryName = args[++i];
+        } else if (NEO::ConstStringRef("-deduplicate_binaries") == args[i]) {
+            deduplicate = true;
         } else {
             fileNamesToConcat.push_back(args[i]);
         }
@@ -100,6 +102,15 @@ AOT::PRODUCT_CONFIG OclocConcat::getAOTProductConfigFromBinary(ArrayRef<const ui
     return productConfig;
 }
 
+void OclocConcat::appendFileEntry(Ar::ArEncoder &arEncoder, ConstStringRef fileName, ArrayRef<const uint8_t> fileData) {
+    // aliased entries are not understood by older runtimes, deduplication has to be requested explicitly
+    if (deduplicate) {
+        arEncoder.appendDeduplicatedFileEntry(fileName, fileData);
+    } else {
+        arEncoder.appendFileEntry(fileName, fileData);
+    }
+}
+
 OclocConcat::ErrorCode OclocConcat::concatenate() {
     NEO::Ar::ArEncoder arEncoder(true);
     for (auto &fileName : fileNamesToConcat) {
@@ -121,7 +132,7 @@ OclocConcat::ErrorCode OclocConcat::concatenate() {
                 if (NEO::ConstStringRef(fileEntry.fileName).startsWith("pad_")) {
                     continue;
                 }
-                arEncoder.appendFileEntry(fileEntry.fileName, fileEntry.fileData);
+                appendFileEntry(arEncoder, fileEntry.fileName, fileEntry.fileData);
             }
         } else {
             std::string errors;
@@ -131,7 +142,7 @@ OclocConcat::ErrorCode OclocConcat::concatenate() {
                 return OCLOC_INVALID_FILE;
             }
             auto entryName = ProductConfigHelper::parseMajorMinorRevisionValue(productConfig);
-            arEncoder.appendFileEntry(entryName, fileRef);
+            appendFileEntry(arEncoder, entryName, fileRef);
         }
     }
 
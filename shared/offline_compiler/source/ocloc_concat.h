@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@ class OclocArgHelper;
 namespace NEO {
 namespace Ar {
 struct Ar;
+struct ArEncoder;
 }
 
 class OclocConcat {
@@ -39,7 +40,11 @@ class OclocConcat {
     static constexpr ConstStringRef commandStr = "concat";
     static constexpr ConstStringRef helpMessage = R"===(
 ocloc concat - concatenates fat binary files
-Usage: ocloc concat <fat binary> <fat binary> ... [-out <concatenated fat binary file name>]
+Usage: ocloc concat <fat binary> <fat binary> ... [-out <concatenated fat binary file name>] [-deduplicate_binaries]
+
+  -deduplicate_binaries    Stores identical device binaries once, other entries
+                           reference them by name. Such fat binary requires
+                           a runtime able to resolve these references.
 )===";
 
   protected:
@@ -48,9 +53,11 @@ Usage: ocloc concat <fat binary> <fat binary> ... [-out <concatenated fat binary
     AOT::PRODUCT_CONFIG getAOTProductConfigFromBinary(ArrayRef<const uint8_t> binary, std::string &outErrors);
     ErrorCode parseArguments(const std::vector<std::string> &args);
     void printMsg(ConstStringRef fileName, const std::string &message);
+    void appendFileEntry(Ar::ArEncoder &arEncoder, ConstStringRef fileName, ArrayRef<const uint8_t> fileData);
 
     OclocArgHelper *argHelper;
     std::vector<std::string> fileNamesToConcat;
     std::string fatBinaryName = "concat.ar";
+    bool deduplicate = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,11 +20,13 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/product_config_helper.h"
+#include "shared/source/utilities/parallel_jobs.h"
 
 #include "igfxfmid.h"
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -260,9 +262,7 @@ std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceA
     return retVal;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
+int compileFatBinaryTarget(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
     if (retVal == 0) {
         retVal = buildWithSafetyGuard(pCompiler);
         std::string buildLog = pCompiler->getBuildLog();
@@ -280,10 +280,10 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
             argHelper->printf("\n");
         }
     }
-    if (retVal) {
-        return retVal;
-    }
+    return retVal;
+}
 
+void appendFatBinaryTarget(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product, bool deduplicate) {
     std::string productConfig("");
     if (product.find(".") != std::string::npos) {
         productConfig = product;
@@ -291,10 +291,78 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
         productConfig = ProductConfigHelper::parseMajorMinorRevisionValue(argHelper->productConfigHelper->getProductConfigFromDeviceName(product));
     }
 
-    fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
+    // aliased entries are not understood by older runtimes, deduplication has to be requested explicitly
+    if (deduplicate) {
+        fatbinary.appendDeduplicatedFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
+    } else {
+        fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
+    }
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product, bool deduplicate) {
+    retVal = compileFatBinaryTarget(retVal, argsCopy, pCompiler, argHelper, product);
+    if (retVal) {
+        return retVal;
+    }
+
+    appendFatBinaryTarget(pointerSize, fatbinary, pCompiler, argHelper, product, deduplicate);
     return retVal;
 }
 
+int buildFatBinaryTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts,
+                                    size_t jobsCount, const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr, bool deduplicate) {
+    struct TargetBuild {
+        std::unique_ptr<OclocArgHelper> argHelper;
+        std::unique_ptr<OfflineCompiler> compiler;
+        int retVal = OCLOC_SUCCESS;
+    };
+
+    std::vector<TargetBuild> targetBuilds(targetProducts.size());
+    std::atomic_bool buildFailed = false;
+    runParallelJobs(targetProducts.size(), jobsCount, [&](size_t index) {
+        // targets are handed out in order, so targets skipped after a failure are never reached when collecting results
+        if (buildFailed) {
+            return;
+        }
+
+        auto &targetBuild = targetBuilds[index];
+        auto targetArgs = argsCopy;
+        targetArgs[deviceArgIndex] = targetProducts[index].str();
+
+        targetBuild.argHelper = std::make_unique<OclocArgHelper>();
+        targetBuild.argHelper->getPrinterRef().setSuppressMessages(true);
+        targetBuild.compiler.reset(OfflineCompiler::create(targetArgs.size(), targetArgs, false, targetBuild.retVal, targetBuild.argHelper.get()));
+        if (OCLOC_SUCCESS != targetBuild.retVal) {
+            targetBuild.argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+        } else {
+            targetBuild.retVal = compileFatBinaryTarget(targetBuild.retVal, targetArgs, targetBuild.compiler.get(), targetBuild.argHelper.get(), targetProducts[index].str());
+        }
+        if (targetBuild.retVal) {
+            buildFailed = true;
+        }
+    });
+
+    if (std::find(argsCopy.begin(), argsCopy.end(), "-qq") != argsCopy.end()) {
+        argHelper->getPrinterRef().setSuppressMessages(true);
+    }
+
+    // logs and binaries are collected in targets order, independent of the order in which builds have finished
+    for (size_t i = 0; i < targetBuilds.size(); ++i) {
+        auto &targetBuild = targetBuilds[i];
+        argHelper->printf(targetBuild.argHelper->getPrinterRef().getLog().str().c_str());
+        if (targetBuild.retVal) {
+            return targetBuild.retVal;
+        }
+
+        appendFatBinaryTarget(pointerSize, fatbinary, targetBuild.compiler.get(), argHelper, targetProducts[i].str(), deduplicate);
+        if (optionsForIr.empty()) {
+            optionsForIr = targetBuild.compiler->getOptions();
+        }
+    }
+    return OCLOC_SUCCESS;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -303,6 +371,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    bool deduplicate = false;
+    size_t jobsCount = 1;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
 
     std::vector<std::string> argsCopy(args);
@@ -330,6 +400,11 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if (ConstStringRef("-deduplicate_binaries") == currArg) {
+            deduplicate = true;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            jobsCount = parseJobsCount(args[argIndex + 1]);
+            ++argIndex;
         } else if (("-device_options" == currArg) && hasAtLeast2MoreArgs) {
             const auto deviceAcronyms = CompilerOptions::tokenize(args[argIndex + 1], ',');
             for (const auto &deviceAcronym : deviceAcronyms) {
@@ -363,22 +438,29 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (jobsCount > 1 && targetProducts.size() > 1 && !argHelper->outputEnabled()) {
+        auto retVal = buildFatBinaryTargetsInParallel(argsCopy, deviceArgIndex, targetProducts, jobsCount, pointerSizeInBits, fatbinary, argHelper, optionsForIr, deduplicate);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str(), deduplicate);
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1026,6 +1026,11 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-exclude_ir" == currArg) {
             excludeIr = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // consumed by fatbinary builds, single target build runs in one job
+            argIndex++;
+        } else if ("-deduplicate_binaries" == currArg) {
+            // consumed by fatbinary builds
         } else if ("--format" == currArg) {
             formatToEnforce = argv[argIndex + 1];
             argIndex++;
@@ -1338,6 +1343,15 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -exclude_ir                               Excludes IR from the output binary file.
 
+  -j <jobs>                                 Number of target devices compiled in parallel
+                                            when building fatbinary. 0 means one job
+                                            per hardware thread.
+
+  -deduplicate_binaries                     Stores identical device binaries of fatbinary
+                                            targets once, other targets reference them
+                                            by name. Such fatbinary requires a runtime
+                                            able to resolve these references.
+
   --format                                  Enforce given binary format. The possible values are:
                                             --format zebin - Enforce generating zebin binary
                                             --format patchtokens - Enforce generating patchtokens (legacy) binary.
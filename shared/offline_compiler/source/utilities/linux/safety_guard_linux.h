@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,32 +11,31 @@
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
-
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
-        struct sigaction sigact {};
+        // Signal handlers are process wide while guarded calls may run concurrently on many threads,
+        // so handlers are installed once and crashes are routed to the guarded call of the faulting thread.
+        std::call_once(handlersInstalled, []() {
+            struct sigaction sigact {};
 
-        sigact.sa_sigaction = sigAction;
-        sigact.sa_flags = SA_RESTART | SA_SIGINFO;
-        sigaction(SIGSEGV, &sigact, &previousSigSegvAction);
-        sigaction(SIGILL, &sigact, &previousSigIllvAction);
+            sigact.sa_sigaction = sigAction;
+            sigact.sa_flags = SA_RESTART | SA_SIGINFO;
+            sigaction(SIGSEGV, &sigact, &previousSigSegvAction);
+            sigaction(SIGILL, &sigact, &previousSigIllvAction);
+        });
     }
 
-    ~SafetyGuardLinux() {
-        if (previousSigSegvAction.sa_sigaction) {
-            sigaction(SIGSEGV, &previousSigSegvAction, NULL);
-        }
-        if (previousSigIllvAction.sa_sigaction) {
-            sigaction(SIGILL, &previousSigIllvAction, NULL);
+    static void sigAction(int sigNum, siginfo_t *info, void *ucontext) {
+        if (!callInProgress) {
+            callPreviousAction(sigNum, info, ucontext);
+            return;
         }
-    }
 
-    static void sigAction(int sigNum, siginfo_t *info, void *ucontext) {
         const int callstackDepth = 30;
         void *addresses[callstackDepth];
         char **callstack;
@@ -50,17 +49,33 @@ class SafetyGuardLinux {
         }
 
         free(callstack);
-        longjmp(jmpbuf, 1);
+        siglongjmp(jmpbuf, 1);
+    }
+
+    static void callPreviousAction(int sigNum, siginfo_t *info, void *ucontext) {
+        auto &previousAction = (sigNum == SIGSEGV) ? previousSigSegvAction : previousSigIllvAction;
+        if (previousAction.sa_flags & SA_SIGINFO) {
+            previousAction.sa_sigaction(sigNum, info, ucontext);
+        } else if (previousAction.sa_handler != SIG_DFL && previousAction.sa_handler != SIG_IGN) {
+            previousAction.sa_handler(sigNum);
+        } else {
+            // faulting instruction is executed again and terminates the process
+            signal(sigNum, SIG_DFL);
+        }
     }
 
     template <typename T, typename Object, typename Method>
     T call(Object *object, Method method, T retValueOnCrash) {
         int jump = 0;
-        jump = setjmp(jmpbuf);
+        jump = sigsetjmp(jmpbuf, 1);
 
         if (jump == 0) {
-            return (object->*method)();
+            callInProgress = true;
+            auto retVal = (object->*method)();
+            callInProgress = false;
+            return retVal;
         } else {
+            callInProgress = false;
             if (onSigSegv) {
                 onSigSegv();
             } else {
@@ -72,6 +87,10 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction {};
-    struct sigaction previousSigIllvAction {};
+
+    static inline thread_local sigjmp_buf jmpbuf;
+    static inline thread_local bool callInProgress = false;
+    static inline std::once_flag handlersInstalled;
+    static inline struct sigaction previousSigSegvAction {};
+    static inline struct sigaction previousSigIllvAction {};
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,8 +11,6 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
-
 class SafetyGuardWindows {
   public:
     template <typename T, typename Object, typename Method>
@@ -35,4 +33,7 @@ class SafetyGuardWindows {
 
     typedef void (*callbackFunction)();
     callbackFunction onExcept = nullptr;
+
+    // guarded calls may run concurrently on many threads
+    static inline thread_local jmp_buf jmpbuf;
 };
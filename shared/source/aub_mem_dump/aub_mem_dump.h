@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,12 @@
 #include "shared/source/aub_mem_dump/aub_data.h"
 
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 
 namespace NEO {
+class AsyncFileWriter;
 class AubHelper;
 }
 
@@ -120,6 +122,9 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    AubFileStream();
+    ~AubFileStream() override;
+
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -140,7 +145,14 @@ struct AubFileStream : public AubStream {
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
 
+    // memory dumps are written page by page, large buffer keeps them from turning into separate file writes
+    static constexpr size_t writeBufferSize = 4 * 1024 * 1024;
+    static constexpr size_t asyncWriterBlockSize = 4 * 1024 * 1024;
+    static constexpr size_t asyncWriterMaxQueuedBlocks = 16;
+    std::unique_ptr<char[]> writeBuffer;
     std::ofstream fileHandle;
+    // optional, moves file writes off the submitting thread
+    std::unique_ptr<NEO::AsyncFileWriter> asyncWriter;
     std::string fileName;
     std::mutex mutex;
 };
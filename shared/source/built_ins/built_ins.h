@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,11 @@
 #include "shared/source/built_ins/sip_kernel_type.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -105,11 +107,10 @@ struct EmbeddedStorageRegistry {
         return gsr;
     }
 
-    void store(const std::string &name, BuiltinResourceT &&resource) {
-        resources.emplace(name, BuiltinResourceT(std::move(resource)));
-    }
+    void store(const std::string &name, BuiltinResourceT &&resource);
+    void store(const std::string &name, ArrayRef<const char> resource);
 
-    const BuiltinResourceT *get(const std::string &name) const;
+    ArrayRef<const char> get(const std::string &name) const;
 
     ~EmbeddedStorageRegistry() {
         exists = false;
@@ -120,8 +121,10 @@ struct EmbeddedStorageRegistry {
         exists = true;
     }
 
-    using ResourcesContainer = std::unordered_map<std::string, BuiltinResourceT>;
+    // views into embedded arrays or into ownedResources, embedded data is never copied
+    using ResourcesContainer = std::unordered_map<std::string, ArrayRef<const char>>;
     ResourcesContainer resources;
+    std::deque<BuiltinResourceT> ownedResources;
 };
 
 class EmbeddedStorage : public Storage {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -148,23 +148,35 @@ BuiltinResourceT FileStorage::loadImpl(const std::string &fullResourceName) {
     return ret;
 }
 
-const BuiltinResourceT *EmbeddedStorageRegistry::get(const std::string &name) const {
+void EmbeddedStorageRegistry::store(const std::string &name, BuiltinResourceT &&resource) {
+    if (resources.find(name) != resources.end()) {
+        return;
+    }
+    auto &ownedResource = ownedResources.emplace_back(std::move(resource));
+    resources.emplace(name, ArrayRef<const char>(ownedResource.data(), ownedResource.size()));
+}
+
+void EmbeddedStorageRegistry::store(const std::string &name, ArrayRef<const char> resource) {
+    resources.emplace(name, resource);
+}
+
+ArrayRef<const char> EmbeddedStorageRegistry::get(const std::string &name) const {
     auto it = resources.find(name);
     if (resources.end() == it) {
-        return nullptr;
+        return {};
     }
 
-    return &it->second;
+    return it->second;
 }
 
 BuiltinResourceT EmbeddedStorage::loadImpl(const std::string &fullResourceName) {
-    auto *constResource = EmbeddedStorageRegistry::getInstance().get(fullResourceName);
-    if (constResource == nullptr) {
+    auto constResource = EmbeddedStorageRegistry::getInstance().get(fullResourceName);
+    if (constResource.empty()) {
         BuiltinResourceT ret;
         return ret;
     }
 
-    return createBuiltinResource(*constResource);
+    return createBuiltinResource(constResource.begin(), constResource.size());
 }
 
 BuiltinsLib::BuiltinsLib() {
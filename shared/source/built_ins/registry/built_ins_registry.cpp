@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,7 +13,12 @@ namespace NEO {
 
 RegisterEmbeddedResource::RegisterEmbeddedResource(const char *name, const char *resource, size_t resourceLength) {
     auto &storageRegistry = EmbeddedStorageRegistry::getInstance();
-    storageRegistry.store(name, createBuiltinResource(resource, resourceLength));
+    storageRegistry.store(name, ArrayRef<const char>(resource, resourceLength));
+}
+
+RegisterEmbeddedResource::RegisterEmbeddedResource(const char *name, std::string &&resource) {
+    auto &storageRegistry = EmbeddedStorageRegistry::getInstance();
+    storageRegistry.store(name, createBuiltinResource(resource.data(), resource.size() + 1));
 }
 
 } // namespace NEO
\ No newline at end of file
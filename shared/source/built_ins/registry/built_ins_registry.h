@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,12 +11,10 @@
 
 namespace NEO {
 
+// Resource passed as pointer is referenced, not copied, it has to outlive the registry (e.g. a static array).
 struct RegisterEmbeddedResource {
     RegisterEmbeddedResource(const char *name, const char *resource, size_t resourceLength);
-
-    RegisterEmbeddedResource(const char *name, std::string &&resource)
-        : RegisterEmbeddedResource(name, resource.data(), resource.size() + 1) {
-    }
+    RegisterEmbeddedResource(const char *name, std::string &&resource);
 };
 
 } // namespace NEO
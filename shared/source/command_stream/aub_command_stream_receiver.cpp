@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/options.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/async_file_writer.h"
 
 #include <algorithm>
 #include <cstring>
@@ -90,21 +91,43 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t dwordCountMax;
 
+AubFileStream::AubFileStream() = default;
+
+AubFileStream::~AubFileStream() = default;
+
 void AubFileStream::open(const char *filePath) {
+    if (!writeBuffer) {
+        writeBuffer = std::make_unique<char[]>(writeBufferSize);
+    }
+    fileHandle.rdbuf()->pubsetbuf(writeBuffer.get(), writeBufferSize);
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    // aubstream writes its own file, only legacy stream can be written asynchronously
+    if (NEO::debugManager.flags.AUBDumpAsyncFileWriter.get() && fileHandle.is_open()) {
+        asyncWriter = std::make_unique<NEO::AsyncFileWriter>(fileHandle, asyncWriterBlockSize, asyncWriterMaxQueuedBlocks);
+    }
 }
 
 void AubFileStream::close() {
+    asyncWriter.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriter) {
+        asyncWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriter) {
+        asyncWriter->drain();
+        return;
+    }
     fileHandle.flush();
 }
 
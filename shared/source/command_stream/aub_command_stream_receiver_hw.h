@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/command_stream_receiver_simulated_hw.h"
 #include "shared/source/memory_manager/residency_container.h"
 
+#include <unordered_map>
+
 namespace NEO {
 class PDPE;
 class PML4;
@@ -109,6 +111,15 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
   protected:
     constexpr static uint32_t getMaskAndValueForPollForCompletion();
+    bool isPageUnchangedSinceLastWrite(uint64_t physAddress, const void *cpuAddress, size_t size);
+
+    struct WrittenPage {
+        size_t size = 0u;
+        uint64_t contentHash = 0u;
+    };
+    std::unordered_map<uint64_t, WrittenPage> writtenPages;
+    bool skipUnchangedPages = false;
+    bool skipUnchangedPagesInCurrentWrite = false;
 
     bool dumpAubNonWritable = false;
     bool isEngineInitialized = false;
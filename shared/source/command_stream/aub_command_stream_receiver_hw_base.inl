@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -91,6 +91,7 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const std::str
                             ? this->peekHwInfo().capabilityTable.aubDeviceId
                             : static_cast<uint32_t>(debugDeviceId);
     this->defaultSshSize = 64 * MemoryConstants::kiloByte;
+    this->skipUnchangedPages = debugManager.flags.AUBDumpSkipUnchangedPages.get();
 }
 
 template <typename GfxFamily>
@@ -656,6 +657,11 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (isPageUnchangedSinceLastWrite(physAddress, ptrOffset(cpuAddress, offset), size)) {
+            auto vmAddr = alignDown(static_cast<uintptr_t>(gpuAddress) + offset, MemoryConstants::pageSize);
+            AUB::reserveAddressPPGTT(*stream, vmAddr, MemoryConstants::pageSize, alignDown(physAddress, MemoryConstants::pageSize), entryBits, aubHelperHw);
+            return;
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -663,6 +669,29 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
 }
 
+template <typename GfxFamily>
+bool AUBCommandStreamReceiverHw<GfxFamily>::isPageUnchangedSinceLastWrite(uint64_t physAddress, const void *cpuAddress, size_t size) {
+    // used by legacy writer only, aubstream releases page mappings together with allocations
+    // so pages written through aub manager cannot be tracked by physical address
+    if (!skipUnchangedPages) {
+        return false;
+    }
+    if (!skipUnchangedPagesInCurrentWrite) {
+        // GPU may have modified the page since it was dumped, CPU content hash cannot tell
+        writtenPages.erase(physAddress);
+        return false;
+    }
+
+    auto contentHash = Hash::hash(reinterpret_cast<const char *>(cpuAddress), size);
+    auto &writtenPage = writtenPages[physAddress];
+    if (writtenPage.size == size && writtenPage.contentHash == contentHash) {
+        return true;
+    }
+    writtenPage.size = size;
+    writtenPage.contentHash = contentHash;
+    return false;
+}
+
 template <typename GfxFamily>
 bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxAllocation, bool isChunkCopy, uint64_t gpuVaChunkOffset, size_t chunkSize) {
     if (!this->isAubWritable(gfxAllocation)) {
@@ -687,7 +716,9 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
     } else {
         UNRECOVERABLE_IF(isChunkCopy);
+        skipUnchangedPagesInCurrentWrite = AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType());
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        skipUnchangedPagesInCurrentWrite = false;
     }
 
     streamLocked.unlock();
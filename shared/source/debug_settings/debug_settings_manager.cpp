@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -135,6 +135,8 @@ void DebugSettingsManager<debugLevel>::dumpFlags() const {
 
 template <DebugFunctionalityLevel debugLevel>
 void DebugSettingsManager<debugLevel>::injectSettingsFromReader() {
+    readerImpl->beginBatchRead();
+
 #undef DECLARE_DEBUG_VARIABLE
 #define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description)                                        \
     {                                                                                                                    \
@@ -158,6 +160,8 @@ void DebugSettingsManager<debugLevel>::injectSettingsFromReader() {
     }
 #include "release_variables.inl"
 #undef DECLARE_DEBUG_VARIABLE
+
+    readerImpl->endBatchRead();
 }
 
 void logDebugString(std::string_view debugString) {
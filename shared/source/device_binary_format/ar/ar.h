@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,9 @@ namespace Ar {
 inline constexpr ConstStringRef arMagic = "!<arch>\n";
 inline constexpr ConstStringRef arFileEntryTrailingMagic = "\x60\x0A";
 
+// Data of file entry that duplicates data of an earlier file entry - magic followed by the earlier entry's name
+inline constexpr ConstStringRef arFileEntryAliasMagic = "!<alias>\n";
+
 struct ArFileEntryHeader {
     char identifier[16] = {'/', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
     char fileModificationTimestamp[12] = {'0', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
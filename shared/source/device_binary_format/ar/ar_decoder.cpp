@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -57,6 +58,15 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
                     return {};
                 }
             }
+            if (hasSameMagic(arFileEntryAliasMagic, fileEntry.fileData)) {
+                ConstStringRef aliasedFileName(reinterpret_cast<const char *>(fileEntry.fileData.begin()) + arFileEntryAliasMagic.size(), fileEntry.fileData.size() - arFileEntryAliasMagic.size());
+                auto aliasedFile = std::find_if(ret.files.rbegin(), ret.files.rend(), [&aliasedFileName](const auto &file) { return file.fileName == aliasedFileName; });
+                if (aliasedFile == ret.files.rend()) {
+                    outErrReason = "Corrupt AR archive - alias file entry with identifier '" + fileEntry.fileName.str() + "' refers to unknown file entry '" + aliasedFileName.str() + "'";
+                    return {};
+                }
+                fileEntry.fileData = aliasedFile->fileData;
+            }
             ret.files.push_back(fileEntry);
         }
 
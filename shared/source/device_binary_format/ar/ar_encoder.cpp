@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,9 @@
 
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 
+#include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/string.h"
 
 #include <vector>
@@ -50,9 +52,47 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
     this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
     this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
+    this->lastDataOffsetForFileName[fileName.str()] = newFileHeaderOffset + sizeof(header);
     return reinterpret_cast<ArFileEntryHeader *>(this->fileEntries.data() + newFileHeaderOffset);
 }
 
+ArFileEntryHeader *ArEncoder::appendDeduplicatedFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData) {
+    if (hasSameMagic(arFileEntryAliasMagic, fileData)) {
+        return appendFileEntry(fileName, fileData);
+    }
+
+    auto dataHash = Hash::hash(reinterpret_cast<const char *>(fileData.begin()), fileData.size());
+    auto candidates = this->uniqueFileEntries.equal_range(dataHash);
+    for (auto it = candidates.first; it != candidates.second; ++it) {
+        const auto &uniqueEntry = it->second;
+        if ((uniqueEntry.dataSize != fileData.size()) ||
+            (0 != memcmp(this->fileEntries.data() + uniqueEntry.dataOffset, fileData.begin(), fileData.size()))) {
+            continue;
+        }
+
+        // aliases are resolved to the latest preceding entry with given name, so it must still be the unique one
+        if (this->lastDataOffsetForFileName[uniqueEntry.fileName] != uniqueEntry.dataOffset) {
+            continue;
+        }
+
+        std::string aliasData = arFileEntryAliasMagic.str() + uniqueEntry.fileName;
+        if (aliasData.size() >= fileData.size()) {
+            break;
+        }
+        return appendFileEntry(fileName, ArrayRef<const uint8_t>::fromAny(aliasData.data(), aliasData.size()));
+    }
+
+    auto header = appendFileEntry(fileName, fileData);
+    if (nullptr != header) {
+        UniqueFileEntry uniqueEntry;
+        uniqueEntry.fileName = fileName.str();
+        uniqueEntry.dataOffset = reinterpret_cast<uint8_t *>(header + 1) - this->fileEntries.data();
+        uniqueEntry.dataSize = fileData.size();
+        this->uniqueFileEntries.emplace(dataHash, std::move(uniqueEntry));
+    }
+    return header;
+}
+
 std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
     ret.reserve(arMagic.size() + 1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,8 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -20,10 +22,20 @@ namespace Ar {
 struct ArEncoder {
     ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
+    // Appends alias to earlier file entry with identical data (see arFileEntryAliasMagic) instead of a copy of the data
+    ArFileEntryHeader *appendDeduplicatedFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
 
   protected:
+    struct UniqueFileEntry {
+        std::string fileName;
+        size_t dataOffset = 0U;
+        size_t dataSize = 0U;
+    };
+
     std::vector<uint8_t> fileEntries;
+    std::unordered_multimap<uint64_t, UniqueFileEntry> uniqueFileEntries;
+    std::unordered_map<std::string, size_t> lastDataOffsetForFileName;
     bool padTo8Bytes = false;
     uint32_t paddingEntry = 0U;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,8 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
         return nullptr;
     }
 
+    drm->setupQueryCache();
+
     const DeviceDescriptor *deviceDescriptor = nullptr;
     const char *deviceName = "";
     for (auto &deviceDescriptorEntry : deviceDescriptorTable) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string_helpers.h"
+#include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/debug_env_reader.h"
@@ -44,6 +45,7 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
 
 ExecutionEnvironment::~ExecutionEnvironment() {
     if (memoryManager) {
+        memoryManager->getHostPtrManager()->releaseUnusedFragments(*memoryManager);
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
             releaseRootDeviceEnvironmentResources(rootDeviceEnvironment.get());
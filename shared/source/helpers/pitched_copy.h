@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+
+#include <cstddef>
+
+namespace NEO {
+
+// Copies rowCount x sliceCount rows of rowSize bytes between pitched surfaces.
+// Rows (and whole slices) that are contiguous on both sides are merged into a single memcpy,
+// so linear images without row padding are transferred with one call instead of one per row.
+inline void copyPitchedRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                              const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                              size_t rowSize, size_t rowCount, size_t sliceCount) {
+    if (rowSize == 0 || rowCount == 0 || sliceCount == 0) {
+        return;
+    }
+
+    if (rowCount == 1) {
+        dstRowPitch = srcRowPitch = rowSize;
+    }
+    bool rowsContiguous = (rowSize == srcRowPitch) && (rowSize == dstRowPitch);
+    size_t sliceSize = rowSize * rowCount;
+
+    if (rowsContiguous) {
+        if (sliceCount == 1 || (sliceSize == srcSlicePitch && sliceSize == dstSlicePitch)) {
+            memcpy_s(dst, sliceSize * sliceCount, src, sliceSize * sliceCount);
+            return;
+        }
+        for (size_t slice = 0; slice < sliceCount; slice++) {
+            memcpy_s(ptrOffset(dst, dstSlicePitch * slice), sliceSize, ptrOffset(src, srcSlicePitch * slice), sliceSize);
+        }
+        return;
+    }
+
+    for (size_t slice = 0; slice < sliceCount; slice++) {
+        auto srcSlice = ptrOffset(src, srcSlicePitch * slice);
+        auto dstSlice = ptrOffset(dst, dstSlicePitch * slice);
+        for (size_t row = 0; row < rowCount; row++) {
+            memcpy_s(ptrOffset(dstSlice, dstRowPitch * row), rowSize, ptrOffset(srcSlice, srcRowPitch * row), rowSize);
+        }
+    }
+}
+
+} // namespace NEO
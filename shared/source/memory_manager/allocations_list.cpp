@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,12 +86,15 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
 }
 
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
+    auto memoryManager = neoDevice->getMemoryManager();
     auto *curr = head;
+    memoryManager->startBatchedGpuRangeRelease();
     while (curr != nullptr) {
         auto currNext = curr->next;
-        neoDevice->getMemoryManager()->freeGraphicsMemory(curr);
+        memoryManager->freeGraphicsMemory(curr);
         curr = currNext;
     }
+    memoryManager->endBatchedGpuRangeRelease();
     head = nullptr;
     tail = nullptr;
 }
@@ -14,6 +14,8 @@
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::heapInternalDeviceMemory,
@@ -168,6 +170,42 @@ void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     }
 }
 
+void GfxPartition::freeGpuAddressRanges(std::vector<HeapChunk> &ranges) {
+    // Adjacent ranges of the same heap are returned to the allocator as a single chunk,
+    // ranges are never merged across heap boundaries.
+    std::array<std::vector<HeapChunk>, heapNonSvmNames.size()> rangesPerHeap;
+    for (auto &range : ranges) {
+        for (size_t i = 0; i < heapNonSvmNames.size(); i++) {
+            auto &heap = getHeap(heapNonSvmNames[i]);
+            if ((range.ptr > heap.getBase()) && ((range.ptr + range.size) < heap.getLimit())) {
+                rangesPerHeap[i].push_back(range);
+                break;
+            }
+        }
+    }
+    ranges.clear();
+
+    for (size_t i = 0; i < heapNonSvmNames.size(); i++) {
+        auto &heapRanges = rangesPerHeap[i];
+        if (heapRanges.empty()) {
+            continue;
+        }
+        std::sort(heapRanges.begin(), heapRanges.end());
+
+        auto &heap = getHeap(heapNonSvmNames[i]);
+        auto mergedRange = heapRanges[0];
+        for (size_t j = 1; j < heapRanges.size(); j++) {
+            if (mergedRange.ptr + mergedRange.size == heapRanges[j].ptr) {
+                mergedRange.size += heapRanges[j].size;
+                continue;
+            }
+            heap.free(mergedRange.ptr, mergedRange.size);
+            mergedRange = heapRanges[j];
+        }
+        heap.free(mergedRange.ptr, mergedRange.size);
+    }
+}
+
 uint64_t GfxPartition::getHeapMinimalAddress(HeapIndex heapIndex) {
     if (heapIndex == HeapIndex::heapSvm ||
         heapIndex == HeapIndex::heapExternalDeviceFrontWindow ||
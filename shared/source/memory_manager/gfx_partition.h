@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,11 @@
 #include "shared/source/os_interface/os_memory.h"
 
 #include <array>
+#include <vector>
 
 namespace NEO {
 class HeapAllocator;
+struct HeapChunk;
 
 enum class HeapIndex : uint32_t {
     heapInternalDeviceMemory = 0u,
@@ -74,6 +76,7 @@ class GfxPartition {
     }
 
     MOCKABLE_VIRTUAL void freeGpuAddressRange(uint64_t ptr, size_t size);
+    MOCKABLE_VIRTUAL void freeGpuAddressRanges(std::vector<HeapChunk> &ranges);
 
     uint64_t getHeapBase(HeapIndex heapIndex) {
         return getHeap(heapIndex).getBase();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,13 @@
 
 #include "shared/source/memory_manager/host_ptr_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/abort.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
@@ -95,6 +98,8 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
                                                                           requirements.allocationFragments[i].allocationSize, overlapStatus);
         if (overlapStatus == OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT) {
             UNRECOVERABLE_IF(fragmentStorage == nullptr);
+            markFragmentAsUsed({fragmentStorage->fragmentCpuPointer, requirements.rootDeviceIndex}, *fragmentStorage);
+            fragmentCacheHits++;
             fragmentStorage->refCount++;
             handleStorage.fragmentStorageData[i].osHandleStorage = fragmentStorage->osInternalStorage;
             handleStorage.fragmentStorageData[i].cpuPtr = requirements.allocationFragments[i].allocationPtr;
@@ -103,11 +108,14 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
         } else if (overlapStatus != OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
             if (fragmentStorage != nullptr) {
                 DEBUG_BREAK_IF(overlapStatus != OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT);
+                markFragmentAsUsed({fragmentStorage->fragmentCpuPointer, requirements.rootDeviceIndex}, *fragmentStorage);
+                fragmentCacheHits++;
                 fragmentStorage->refCount++;
                 handleStorage.fragmentStorageData[i].osHandleStorage = fragmentStorage->osInternalStorage;
                 handleStorage.fragmentStorageData[i].residency = fragmentStorage->residency;
             } else {
                 DEBUG_BREAK_IF(overlapStatus != OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER);
+                fragmentCacheMisses++;
             }
             handleStorage.fragmentStorageData[i].cpuPtr = requirements.allocationFragments[i].allocationPtr;
             handleStorage.fragmentStorageData[i].fragmentSize = requirements.allocationFragments[i].allocationSize;
@@ -126,6 +134,7 @@ void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fr
     HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
     auto element = findElement(key);
     if (element != partialAllocations.end()) {
+        markFragmentAsUsed(element->first, element->second);
         element->second.refCount++;
     } else {
         fragment.refCount++;
@@ -164,6 +173,13 @@ bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
 
     element->second.refCount--;
     if (element->second.refCount <= 0) {
+        auto &fragment = element->second;
+        if (!fragment.driverAllocation && fragment.fragmentSize <= unusedFragmentsCacheSize) {
+            // keep it pinned, evictUnusedFragments() releases it once the cache grows over its size
+            unusedFragments.push_back(element->first);
+            unusedFragmentsSize += fragment.fragmentSize;
+            return false;
+        }
         fragmentReadyToBeReleased = true;
         partialAllocations.erase(element);
     }
@@ -171,6 +187,80 @@ bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
     return fragmentReadyToBeReleased;
 }
 
+void HostPtrManager::markFragmentAsUsed(HostPtrEntryKey key, FragmentStorage &fragment) {
+    if (fragment.refCount > 0 || unusedFragments.empty()) {
+        return;
+    }
+    auto unusedFragment = std::find_if(unusedFragments.begin(), unusedFragments.end(), [&key](const HostPtrEntryKey &unusedKey) {
+        return unusedKey.ptr == key.ptr && unusedKey.rootDeviceIndex == key.rootDeviceIndex;
+    });
+    if (unusedFragment != unusedFragments.end()) {
+        unusedFragments.erase(unusedFragment);
+        unusedFragmentsSize -= fragment.fragmentSize;
+    }
+}
+
+void HostPtrManager::releaseUnusedFragment(MemoryManager &memoryManager, HostPtrEntryKey key) {
+    auto element = partialAllocations.find(key);
+    UNRECOVERABLE_IF(element == partialAllocations.end());
+    auto &fragment = element->second;
+    DEBUG_BREAK_IF(fragment.refCount > 0);
+
+    OsHandleStorage handleStorage;
+    handleStorage.fragmentCount = 1;
+    handleStorage.fragmentStorageData[0].osHandleStorage = fragment.osInternalStorage;
+    handleStorage.fragmentStorageData[0].residency = fragment.residency;
+    handleStorage.fragmentStorageData[0].cpuPtr = fragment.fragmentCpuPointer;
+    handleStorage.fragmentStorageData[0].fragmentSize = fragment.fragmentSize;
+    handleStorage.fragmentStorageData[0].freeTheFragment = true;
+
+    unusedFragmentsSize -= fragment.fragmentSize;
+    partialAllocations.erase(element);
+    memoryManager.cleanOsHandles(handleStorage, key.rootDeviceIndex);
+}
+
+void HostPtrManager::evictUnusedFragments(MemoryManager &memoryManager) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    while (unusedFragmentsSize > unusedFragmentsCacheSize) {
+        auto key = unusedFragments.front();
+        unusedFragments.pop_front();
+        releaseUnusedFragment(memoryManager, key);
+    }
+}
+
+void HostPtrManager::releaseUnusedFragments(MemoryManager &memoryManager) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    if (unusedFragmentsCacheSize > 0u) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "Host ptr pin cache: %llu hits, %llu misses\n",
+                           static_cast<unsigned long long>(fragmentCacheHits), static_cast<unsigned long long>(fragmentCacheMisses));
+    }
+    while (!unusedFragments.empty()) {
+        auto key = unusedFragments.front();
+        unusedFragments.pop_front();
+        releaseUnusedFragment(memoryManager, key);
+    }
+}
+
+bool HostPtrManager::releaseOverlappingUnusedFragments(MemoryManager &memoryManager, uint32_t rootDeviceIndex, const void *ptr, size_t size) {
+    bool released = false;
+    auto start = reinterpret_cast<uintptr_t>(ptr);
+    auto end = start + size;
+    for (auto it = unusedFragments.begin(); it != unusedFragments.end();) {
+        auto &fragment = partialAllocations.find(*it)->second;
+        auto fragmentStart = reinterpret_cast<uintptr_t>(fragment.fragmentCpuPointer);
+        auto fragmentEnd = fragmentStart + fragment.fragmentSize;
+        if (it->rootDeviceIndex == rootDeviceIndex && fragmentStart < end && start < fragmentEnd) {
+            auto key = *it;
+            it = unusedFragments.erase(it);
+            releaseUnusedFragment(memoryManager, key);
+            released = true;
+        } else {
+            ++it;
+        }
+    }
+    return released;
+}
+
 FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
     auto element = findElement(key);
@@ -270,6 +360,12 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
 
         getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
                                        requirements->allocationFragments[i].allocationSize, overlapStatus);
+        if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT &&
+            releaseOverlappingUnusedFragments(memoryManager, requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                              requirements->allocationFragments[i].allocationSize)) {
+            getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                           requirements->allocationFragments[i].allocationSize, overlapStatus);
+        }
         if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
             // clean temporary allocations
             memoryManager.cleanTemporaryAllocationListOnAllEngines(false);
@@ -1,11 +1,14 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
+#include <limits>
+#include <list>
 #include <map>
 #include <mutex>
 
@@ -46,6 +49,12 @@ class HostPtrManager {
     void storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment);
     [[nodiscard]] std::unique_lock<std::recursive_mutex> obtainOwnership();
 
+    void setUnusedFragmentsCacheSize(size_t size) { unusedFragmentsCacheSize = size; }
+    void evictUnusedFragments(MemoryManager &memoryManager);
+    void releaseUnusedFragments(MemoryManager &memoryManager);
+    uint64_t getFragmentCacheHits() const { return fragmentCacheHits; }
+    uint64_t getFragmentCacheMisses() const { return fragmentCacheMisses; }
+
   protected:
     static AllocationRequirements getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size);
     OsHandleStorage populateAlreadyAllocatedFragments(AllocationRequirements &requirements);
@@ -53,7 +62,18 @@ class HostPtrManager {
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
 
     HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
+    void markFragmentAsUsed(HostPtrEntryKey key, FragmentStorage &fragment);
+    void releaseUnusedFragment(MemoryManager &memoryManager, HostPtrEntryKey key);
+    bool releaseOverlappingUnusedFragments(MemoryManager &memoryManager, uint32_t rootDeviceIndex, const void *ptr, size_t size);
+
     HostPtrFragmentsContainer partialAllocations;
     std::recursive_mutex allocationsMutex;
+
+    // Fragments with refCount == 0 kept pinned for reuse, least recently used first
+    std::list<HostPtrEntryKey> unusedFragments;
+    size_t unusedFragmentsCacheSize = 0u;
+    size_t unusedFragmentsSize = 0u;
+    uint64_t fragmentCacheHits = 0u;
+    uint64_t fragmentCacheMisses = 0u;
 };
 } // namespace NEO
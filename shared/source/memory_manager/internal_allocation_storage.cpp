@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,7 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
     IDList<GraphicsAllocation, false, true> allocationsLeft;
+    memoryManager->startBatchedGpuRangeRelease();
     while (curr != nullptr) {
         auto *next = curr->next;
         if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
@@ -58,6 +59,7 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
         }
         curr = next;
     }
+    memoryManager->endBatchedGpuRangeRelease();
 
     if (allocationsLeft.peekIsEmpty() == false) {
         allocationsList.splice(*allocationsLeft.detachNodes());
@@ -85,6 +85,10 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     if (debugManager.flags.EnableMultiStorageResources.get() != -1) {
         supportsMultiStorageResources = !!debugManager.flags.EnableMultiStorageResources.get();
     }
+
+    if (debugManager.flags.HostPtrPinCacheSize.get() > 0) {
+        hostPtrManager->setUnusedFragmentsCacheSize(static_cast<size_t>(debugManager.flags.HostPtrPinCacheSize.get()));
+    }
 }
 
 MemoryManager::~MemoryManager() {
@@ -201,6 +205,7 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryForImageFromHostPtr(con
 void MemoryManager::cleanGraphicsMemoryCreatedFromHostPtr(GraphicsAllocation *graphicsAllocation) {
     hostPtrManager->releaseHandleStorage(graphicsAllocation->getRootDeviceIndex(), graphicsAllocation->fragmentsStorage);
     cleanOsHandles(graphicsAllocation->fragmentsStorage, graphicsAllocation->getRootDeviceIndex());
+    hostPtrManager->evictUnusedFragments(*this);
 }
 
 void *MemoryManager::createMultiGraphicsAllocationInSystemMemoryPool(RootDeviceIndicesContainer &rootDeviceIndices, AllocationProperties &properties, MultiGraphicsAllocation &multiGraphicsAllocation, void *ptr) {
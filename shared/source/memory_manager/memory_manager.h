@@ -152,6 +152,9 @@ class MemoryManager {
     virtual void freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation, bool isImportedAllocation) = 0;
     MOCKABLE_VIRTUAL void freeGraphicsMemory(GraphicsAllocation *gfxAllocation);
     MOCKABLE_VIRTUAL void freeGraphicsMemory(GraphicsAllocation *gfxAllocation, bool isImportedAllocation);
+    // Bracket freeing many allocations in a row, GPU VA ranges released by the calling thread in between may be returned to the heaps in one pass
+    virtual void startBatchedGpuRangeRelease() {}
+    virtual void endBatchedGpuRangeRelease() {}
     virtual void handleFenceCompletion(GraphicsAllocation *allocation){};
 
     void checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation);
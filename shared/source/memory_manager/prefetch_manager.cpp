@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,14 +8,36 @@
 #include "shared/source/memory_manager/prefetch_manager.h"
 
 #include "shared/source/device/device.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <iterator>
 
 namespace NEO {
 
+// requests may be queued for any pointer within the allocation, pending requests are tracked per allocation base address
+static uint64_t getAllocationKey(const SvmAllocationData &allocData) {
+    return allocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress();
+}
+
 std::unique_ptr<PrefetchManager> PrefetchManager::create() {
     return std::make_unique<PrefetchManager>();
 }
 
+PrefetchManager::~PrefetchManager() {
+    if (prefetchThread) {
+        {
+            std::lock_guard<std::mutex> lock(requestsMutex);
+            keepRunning.store(false);
+        }
+        requestQueued.notify_one();
+
+        prefetchThread->join();
+        prefetchThread.reset();
+    }
+}
+
 void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData) {
     std::unique_lock<SpinLock> lock{context.lock};
     if (allocData.memoryType == InternalMemoryType::sharedUnifiedMemory) {
@@ -23,19 +45,123 @@ void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usm
     }
 }
 
+void PrefetchManager::insertAllocationAndPrefetchAsync(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData,
+                                                       SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) {
+    if (allocData.memoryType != InternalMemoryType::sharedUnifiedMemory) {
+        return;
+    }
+
+    std::unique_lock<SpinLock> contextLock{context.lock};
+    context.allocations.push_back(usmPtr);
+    context.asyncPrefetchedAllocations.insert(usmPtr);
+
+    std::lock_guard<std::mutex> lock(requestsMutex);
+    if (!prefetchThread) {
+        prefetchThread = Thread::create(processRequests, reinterpret_cast<void *>(this));
+        asyncPrefetchUsed.store(true);
+    }
+    queuedRequests.push_back({usmPtr, &unifiedMemoryManager, &device, &csr});
+    context.lastAsyncRequestId = ++queuedRequestsCount;
+    pendingRequestIds[getAllocationKey(allocData)] = queuedRequestsCount;
+    requestQueued.notify_one();
+}
+
 void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) {
     std::unique_lock<SpinLock> lock{context.lock};
+    waitForContextAsyncPrefetches(context, lock);
     for (auto &ptr : context.allocations) {
+        if (context.asyncPrefetchedAllocations.count(ptr) > 0) {
+            continue;
+        }
         auto allocData = unifiedMemoryManager.getSVMAlloc(ptr);
         if (allocData) {
             unifiedMemoryManager.prefetchMemory(device, csr, *allocData);
         }
     }
+    context.asyncPrefetchedAllocations.clear();
 }
 
 void PrefetchManager::removeAllocations(PrefetchContext &context) {
     std::unique_lock<SpinLock> lock{context.lock};
+    waitForContextAsyncPrefetches(context, lock);
     context.allocations.clear();
+    context.asyncPrefetchedAllocations.clear();
+}
+
+void PrefetchManager::waitForAsyncPrefetches(uint64_t requestId) {
+    std::unique_lock<std::mutex> lock(requestsMutex);
+    requestsCompleted.wait(lock, [&]() { return completedRequestsCount >= requestId; });
+}
+
+void PrefetchManager::waitForAllocationPrefetches(const SvmAllocationData &allocData) {
+    if (!asyncPrefetchUsed.load()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(requestsMutex);
+    auto pendingRequest = pendingRequestIds.find(getAllocationKey(allocData));
+    if (pendingRequest == pendingRequestIds.end()) {
+        return;
+    }
+    auto requestId = pendingRequest->second;
+    requestsCompleted.wait(lock, [&]() { return completedRequestsCount >= requestId; });
+}
+
+void PrefetchManager::waitForContextAsyncPrefetches(PrefetchContext &context, std::unique_lock<SpinLock> &contextLock) {
+    // context lock is released while waiting, so other threads can keep using the context;
+    // requests queued to the context in the meantime are waited for as well
+    uint64_t waitedRequestId = 0;
+    while (!context.asyncPrefetchedAllocations.empty() && context.lastAsyncRequestId > waitedRequestId) {
+        waitedRequestId = context.lastAsyncRequestId;
+        contextLock.unlock();
+        waitForAsyncPrefetches(waitedRequestId);
+        contextLock.lock();
+    }
+}
+
+void PrefetchManager::waitForAllAsyncPrefetches() {
+    if (!asyncPrefetchUsed.load()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(requestsMutex);
+    requestsCompleted.wait(lock, [&]() { return completedRequestsCount == queuedRequestsCount; });
+}
+
+void PrefetchManager::prefetchBatch(std::vector<PrefetchRequest> &batch) {
+    for (auto &request : batch) {
+        auto allocData = request.unifiedMemoryManager->getSVMAlloc(request.usmPtr);
+        if (allocData) {
+            request.unifiedMemoryManager->prefetchMemory(*request.device, *request.csr, *allocData);
+        }
+    }
+}
+
+void *PrefetchManager::processRequests(void *self) {
+    auto prefetchManager = reinterpret_cast<PrefetchManager *>(self);
+    std::vector<PrefetchRequest> batch;
+
+    std::unique_lock<std::mutex> lock(prefetchManager->requestsMutex);
+    while (true) {
+        prefetchManager->requestQueued.wait(lock, [prefetchManager]() { return !prefetchManager->keepRunning.load() || !prefetchManager->queuedRequests.empty(); });
+        if (prefetchManager->queuedRequests.empty()) {
+            break;
+        }
+
+        // all requests queued so far are serviced in one pass, producers keep queueing to the emptied vector
+        batch.swap(prefetchManager->queuedRequests);
+        auto batchEnd = prefetchManager->queuedRequestsCount;
+        lock.unlock();
+
+        prefetchManager->prefetchBatch(batch);
+        batch.clear();
+
+        lock.lock();
+        prefetchManager->completedRequestsCount = batchEnd;
+        for (auto it = prefetchManager->pendingRequestIds.begin(); it != prefetchManager->pendingRequestIds.end();) {
+            it = (it->second <= batchEnd) ? prefetchManager->pendingRequestIds.erase(it) : std::next(it);
+        }
+        prefetchManager->requestsCompleted.notify_all();
+    }
+    return nullptr;
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,12 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -19,9 +24,12 @@ struct SvmAllocationData;
 class CommandStreamReceiver;
 class Device;
 class SVMAllocsManager;
+class Thread;
 
 struct PrefetchContext {
     std::vector<const void *> allocations;
+    std::unordered_set<const void *> asyncPrefetchedAllocations;
+    uint64_t lastAsyncRequestId = 0;
     SpinLock lock;
 };
 
@@ -29,13 +37,46 @@ class PrefetchManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PrefetchManager> create();
 
-    virtual ~PrefetchManager() = default;
+    virtual ~PrefetchManager();
 
     void insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData);
 
+    // Registers allocation like insertAllocation and queues its prefetch to the background worker,
+    // migrateAllocationsToGpu only waits for the requests still in flight instead of prefetching again
+    void insertAllocationAndPrefetchAsync(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData,
+                                          SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
+
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
 
     MOCKABLE_VIRTUAL void removeAllocations(PrefetchContext &context);
+
+    void waitForAsyncPrefetches(uint64_t requestId);
+    void waitForAllocationPrefetches(const SvmAllocationData &allocData);
+    void waitForAllAsyncPrefetches();
+
+  protected:
+    struct PrefetchRequest {
+        const void *usmPtr;
+        SVMAllocsManager *unifiedMemoryManager;
+        Device *device;
+        CommandStreamReceiver *csr;
+    };
+
+    static void *processRequests(void *self);
+    void waitForContextAsyncPrefetches(PrefetchContext &context, std::unique_lock<SpinLock> &contextLock);
+    MOCKABLE_VIRTUAL void prefetchBatch(std::vector<PrefetchRequest> &batch);
+
+    std::vector<PrefetchRequest> queuedRequests;
+    std::unordered_map<uint64_t, uint64_t> pendingRequestIds;
+    uint64_t queuedRequestsCount = 0;
+    uint64_t completedRequestsCount = 0;
+    std::atomic_bool asyncPrefetchUsed = false;
+
+    std::mutex requestsMutex;
+    std::condition_variable requestQueued;
+    std::condition_variable requestsCompleted;
+    std::unique_ptr<Thread> prefetchThread;
+    std::atomic_bool keepRunning = true;
 };
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,9 +15,11 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -123,6 +125,11 @@ void SVMAllocsManager::MapOperationsTracker::remove(const void *regionPtr) {
     operations.erase(iter);
 }
 
+void SVMAllocsManager::MapOperationsTracker::removeRange(const void *rangePtr, size_t rangeSize) {
+    auto rangeEnd = ptrOffset(rangePtr, rangeSize);
+    operations.erase(operations.lower_bound(rangePtr), operations.lower_bound(rangeEnd));
+}
+
 SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionPtr) {
     SvmMapOperationsContainer::iterator iter;
     iter = operations.find(regionPtr);
@@ -471,6 +478,11 @@ bool SVMAllocsManager::freeSVMAllocDefer(void *ptr) {
 void SVMAllocsManager::freeSVMAllocImpl(void *ptr, FreePolicyType policy, SvmAllocationData *svmData) {
     this->prepareIndirectAllocationForDestruction(svmData);
 
+    auto prefetchManager = this->memoryManager->getPrefetchManager();
+    if (prefetchManager) {
+        prefetchManager->waitForAllocationPrefetches(*svmData);
+    }
+
     if (policy == FreePolicyType::blocking) {
         if (svmData->cpuAllocation) {
             this->memoryManager->waitForEnginesCompletion(*svmData->cpuAllocation);
@@ -748,6 +760,11 @@ void SVMAllocsManager::removeSvmMapOperation(const void *regionSvmPtr) {
     svmMapOperations.remove(regionSvmPtr);
 }
 
+void SVMAllocsManager::removeSvmMapOperations(const void *rangePtr, size_t rangeSize) {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    svmMapOperations.removeRange(rangePtr, rangeSize);
+}
+
 AllocationType SVMAllocsManager::getGraphicsAllocationTypeAndCompressionPreference(const UnifiedMemoryProperties &unifiedMemoryProperties, bool &compressionEnabled) const {
     compressionEnabled = false;
 
@@ -104,6 +104,7 @@ class SVMAllocsManager {
         using SvmMapOperationsContainer = std::map<const void *, SvmMapOperation>;
         void insert(SvmMapOperation);
         void remove(const void *);
+        void removeRange(const void *rangePtr, size_t rangeSize);
         SvmMapOperation *get(const void *);
         size_t getNumMapOperations() const { return operations.size(); };
 
@@ -213,6 +214,7 @@ class SVMAllocsManager {
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
+    void removeSvmMapOperations(const void *rangePtr, size_t rangeSize);
     SvmMapOperation *getSvmMapOperation(const void *regionPtr);
     MOCKABLE_VIRTUAL void addInternalAllocationsToResidencyContainer(uint32_t rootDeviceIndex,
                                                                      ResidencyContainer &residencyContainer,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,34 @@ const char *EnvironmentVariableReader::appSpecificLocation(const std::string &na
     return name.c_str();
 }
 
+void EnvironmentVariableReader::beginBatchRead() {
+    environmentSnapshot.clear();
+    auto environment = IoFunctions::getEnvironmentPtr();
+    for (auto entry = environment; entry != nullptr && *entry != nullptr; entry++) {
+        std::string_view variable(*entry);
+        auto separatorPos = variable.find('=');
+        if (separatorPos == std::string_view::npos) {
+            continue;
+        }
+        // first definition wins, same as getenv
+        environmentSnapshot.emplace(variable.substr(0, separatorPos), *entry + separatorPos + 1);
+    }
+    batchReadInProgress = true;
+}
+
+void EnvironmentVariableReader::endBatchRead() {
+    batchReadInProgress = false;
+    environmentSnapshot.clear();
+}
+
+const char *EnvironmentVariableReader::getEnvironmentValue(const char *name) const {
+    if (!batchReadInProgress) {
+        return IoFunctions::getenvPtr(name);
+    }
+    auto it = environmentSnapshot.find(name);
+    return it != environmentSnapshot.end() ? it->second : nullptr;
+}
+
 bool EnvironmentVariableReader::getSetting(const char *settingName, bool defaultValue, DebugVarPrefix &type) {
     return getSetting(settingName, static_cast<int64_t>(defaultValue), type) ? true : false;
 }
@@ -36,7 +64,7 @@ int32_t EnvironmentVariableReader::getSetting(const char *settingName, int32_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue, DebugVarPrefix &type) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
     auto prefixString = ApiSpecificConfig::getPrefixStrings();
     auto prefixType = ApiSpecificConfig::getPrefixTypes();
@@ -45,7 +73,7 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentValue(neoKey.c_str());
         if (envValue) {
             value = atoll(envValue);
             type = prefixType[i];
@@ -59,9 +87,9 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentValue(settingName);
     if (envValue) {
         value = atoll(envValue);
     }
@@ -69,7 +97,7 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
@@ -80,7 +108,7 @@ std::string EnvironmentVariableReader::getSetting(const char *settingName, const
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentValue(neoKey.c_str());
         if (envValue) {
             keyValue.assign(envValue);
             type = prefixType[i];
@@ -93,11 +121,11 @@ std::string EnvironmentVariableReader::getSetting(const char *settingName, const
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentValue(settingName);
     if (envValue) {
         keyValue.assign(envValue);
     }
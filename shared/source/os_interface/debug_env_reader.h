@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,9 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
+#include <string_view>
+#include <unordered_map>
+
 namespace NEO {
 
 class EnvironmentVariableReader : public SettingsReader {
@@ -23,5 +26,14 @@ class EnvironmentVariableReader : public SettingsReader {
     std::string getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) override;
     std::string getSetting(const char *settingName, const std::string &value) override;
     const char *appSpecificLocation(const std::string &name) override;
+    void beginBatchRead() override;
+    void endBatchRead() override;
+
+  protected:
+    const char *getEnvironmentValue(const char *name) const;
+
+    // variables found in a single pass over the environment, used instead of getenv calls during batch read
+    std::unordered_map<std::string_view, const char *> environmentSnapshot;
+    bool batchReadInProgress = false;
 };
 } // namespace NEO
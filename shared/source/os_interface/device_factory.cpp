@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,7 @@
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/parallel_jobs.h"
 
 #include "hw_device_id.h"
 
@@ -139,12 +140,7 @@ bool DeviceFactory::isHwModeSelected() {
     }
 }
 
-static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
-                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
-    if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
-        return false;
-    }
-
+static void initHwDeviceIdResourcesAfterOsInterface(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) {
     if (debugManager.flags.OverrideGpuAddressSpace.get() != -1) {
         executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
             maxNBitValue(static_cast<uint64_t>(debugManager.flags.OverrideGpuAddressSpace.get()));
@@ -156,10 +152,43 @@ static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
     }
 
     executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initGmm();
+}
 
+static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
+                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+    if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
+        return false;
+    }
+
+    initHwDeviceIdResourcesAfterOsInterface(executionEnvironment, rootDeviceIndex);
     return true;
 }
 
+// OS interfaces (device queries done by the KMD) of all discovered devices are initialized concurrently, every device
+// uses root device environment with its discovery index. Remaining initialization runs sequentially, environments of
+// devices that failed are dropped keeping discovery order, root device indices are fixed in adjustRootDeviceEnvironments.
+static uint32_t initHwDeviceIdResourcesInParallel(ExecutionEnvironment &executionEnvironment,
+                                                  std::vector<std::unique_ptr<HwDeviceId>> &hwDeviceIds, uint32_t maxThreads) {
+    const auto deviceCount = static_cast<uint32_t>(hwDeviceIds.size());
+    std::vector<uint8_t> osInterfaceInitialized(deviceCount, 0u);
+
+    runParallelJobs(deviceCount, maxThreads, [&](size_t deviceIndex) {
+        auto &rootDeviceEnvironment = executionEnvironment.rootDeviceEnvironments[deviceIndex];
+        osInterfaceInitialized[deviceIndex] = rootDeviceEnvironment->initOsInterface(std::move(hwDeviceIds[deviceIndex]), static_cast<uint32_t>(deviceIndex));
+    });
+
+    uint32_t rootDeviceIndex = 0u;
+    for (auto deviceIndex = 0u; deviceIndex < deviceCount; deviceIndex++) {
+        if (!osInterfaceInitialized[deviceIndex]) {
+            continue;
+        }
+        std::swap(executionEnvironment.rootDeviceEnvironments[rootDeviceIndex], executionEnvironment.rootDeviceEnvironments[deviceIndex]);
+        initHwDeviceIdResourcesAfterOsInterface(executionEnvironment, rootDeviceIndex);
+        rootDeviceIndex++;
+    }
+    return rootDeviceIndex;
+}
+
 bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnvironment) {
     using HwDeviceIds = std::vector<std::unique_ptr<HwDeviceId>>;
 
@@ -172,12 +201,17 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
 
     uint32_t rootDeviceIndex = 0u;
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
-            continue;
-        }
+    auto maxInitThreads = debugManager.flags.ParallelRootDeviceInitialization.get();
+    if (maxInitThreads > 1 && hwDeviceIds.size() > 1) {
+        rootDeviceIndex = initHwDeviceIdResourcesInParallel(executionEnvironment, hwDeviceIds, static_cast<uint32_t>(maxInitThreads));
+    } else {
+        for (auto &hwDeviceId : hwDeviceIds) {
+            if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+                continue;
+            }
 
-        rootDeviceIndex++;
+            rootDeviceIndex++;
+        }
     }
 
     executionEnvironment.rootDeviceEnvironments.resize(rootDeviceIndex);
@@ -12,6 +12,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/residency.h"
 #include "shared/source/os_interface/linux/cache_info.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
@@ -530,6 +531,24 @@ void DrmAllocation::registerMemoryToUnmap(void *pointer, size_t size, DrmAllocat
     this->memoryToUnmap.push_back({pointer, size, unmapFunction});
 }
 
+bool DrmAllocation::mergeMemoryToUnmap(void *pointer, size_t size, DrmAllocation::MemoryUnmapFunction unmapFunction) {
+    for (auto &memory : this->memoryToUnmap) {
+        if (memory.unmapFunction != unmapFunction) {
+            continue;
+        }
+        if (ptrOffset(memory.pointer, memory.size) == pointer) {
+            memory.size += size;
+            return true;
+        }
+        if (ptrOffset(pointer, size) == memory.pointer) {
+            memory.pointer = pointer;
+            memory.size += size;
+            return true;
+        }
+    }
+    return false;
+}
+
 uint64_t DrmAllocation::getHandleAddressBase(uint32_t handleIndex) {
     return bufferObjects[handleIndex]->peekAddress();
 }
@@ -147,6 +147,7 @@ class DrmAllocation : public GraphicsAllocation {
     MOCKABLE_VIRTUAL void markForCapture();
     MOCKABLE_VIRTUAL bool shouldAllocationPageFault(const Drm *drm);
     void registerMemoryToUnmap(void *pointer, size_t size, MemoryUnmapFunction unmapFunction);
+    bool mergeMemoryToUnmap(void *pointer, size_t size, MemoryUnmapFunction unmapFunction);
 
   protected:
     OsContextLinux *osContext = nullptr;
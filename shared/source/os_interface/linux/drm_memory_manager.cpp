@@ -43,6 +43,7 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/heap_allocator.h"
 
 #include <cstring>
 #include <iostream>
@@ -83,6 +84,7 @@ void DrmMemoryManager::initialize(GemCloseWorkerMode mode) {
             return;
         }
         localMemAllocs.emplace_back();
+        localMemAllocsIndices.emplace_back();
         disableGemCloseWorker &= getDrm(rootDeviceIndex).isVmBindAvailable();
     }
 
@@ -233,10 +235,52 @@ uint64_t DrmMemoryManager::acquireGpuRangeWithCustomAlignment(size_t &size, uint
     return gmmHelper->canonize(gfxPartition->heapAllocateWithCustomAlignment(heapIndex, size, alignment));
 }
 
+namespace {
+struct BatchedGpuRangeRelease {
+    const DrmMemoryManager *memoryManager = nullptr;
+    uint32_t depth = 0u;
+    std::vector<std::vector<HeapChunk>> rangesPerRootDevice;
+};
+thread_local BatchedGpuRangeRelease batchedGpuRangeRelease;
+} // namespace
+
+void DrmMemoryManager::startBatchedGpuRangeRelease() {
+    if (batchedGpuRangeRelease.depth == 0u) {
+        batchedGpuRangeRelease.memoryManager = this;
+    }
+    if (batchedGpuRangeRelease.memoryManager == this) {
+        batchedGpuRangeRelease.depth++;
+    }
+}
+
+void DrmMemoryManager::endBatchedGpuRangeRelease() {
+    if (batchedGpuRangeRelease.memoryManager != this || --batchedGpuRangeRelease.depth > 0u) {
+        return;
+    }
+    batchedGpuRangeRelease.memoryManager = nullptr;
+
+    auto &rangesPerRootDevice = batchedGpuRangeRelease.rangesPerRootDevice;
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < rangesPerRootDevice.size(); rootDeviceIndex++) {
+        if (!rangesPerRootDevice[rootDeviceIndex].empty()) {
+            getGfxPartition(rootDeviceIndex)->freeGpuAddressRanges(rangesPerRootDevice[rootDeviceIndex]);
+        }
+    }
+}
+
 void DrmMemoryManager::releaseGpuRange(void *address, size_t unmapSize, uint32_t rootDeviceIndex) {
     uint64_t graphicsAddress = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
     auto gmmHelper = getGmmHelper(rootDeviceIndex);
     graphicsAddress = gmmHelper->decanonize(graphicsAddress);
+
+    if (batchedGpuRangeRelease.memoryManager == this) {
+        auto &rangesPerRootDevice = batchedGpuRangeRelease.rangesPerRootDevice;
+        if (rangesPerRootDevice.size() <= rootDeviceIndex) {
+            rangesPerRootDevice.resize(rootDeviceIndex + 1);
+        }
+        rangesPerRootDevice[rootDeviceIndex].emplace_back(graphicsAddress, unmapSize);
+        return;
+    }
+
     auto gfxPartition = getGfxPartition(rootDeviceIndex);
     gfxPartition->freeGpuAddressRange(graphicsAddress, unmapSize);
 }
@@ -1139,7 +1183,10 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
     }
 
     if (drmAlloc->getMmapPtr()) {
-        this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
+        // adjacent to a range registered for unmapping (e.g. alignment padding), release both with a single munmap
+        if (!drmAlloc->mergeMemoryToUnmap(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize(), this->munmapFunction)) {
+            this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
+        }
     }
 
     for (auto handleId = 0u; handleId < gfxAllocation->getNumGmms(); handleId++) {
@@ -1450,7 +1497,7 @@ AllocationStatus DrmMemoryManager::registerSysMemAlloc(GraphicsAllocation *alloc
         return AllocationStatus::Error;
     }
     std::lock_guard<std::mutex> lock(this->allocMutex);
-    this->sysMemAllocs.push_back(allocation);
+    addRegisteredAllocation(this->sysMemAllocs, this->sysMemAllocsIndices, allocation);
     return AllocationStatus::Success;
 }
 
@@ -1459,18 +1506,36 @@ AllocationStatus DrmMemoryManager::registerLocalMemAlloc(GraphicsAllocation *all
         return AllocationStatus::Error;
     }
     std::lock_guard<std::mutex> lock(this->allocMutex);
-    this->localMemAllocs[rootDeviceIndex].push_back(allocation);
+    addRegisteredAllocation(this->localMemAllocs[rootDeviceIndex], this->localMemAllocsIndices[rootDeviceIndex], allocation);
     return AllocationStatus::Success;
 }
 
 void DrmMemoryManager::unregisterAllocation(GraphicsAllocation *allocation) {
+    auto rootDeviceIndex = allocation->getRootDeviceIndex();
     std::lock_guard<std::mutex> lock(this->allocMutex);
-    sysMemAllocs.erase(std::remove(sysMemAllocs.begin(), sysMemAllocs.end(), allocation),
-                       sysMemAllocs.end());
-    localMemAllocs[allocation->getRootDeviceIndex()].erase(std::remove(localMemAllocs[allocation->getRootDeviceIndex()].begin(),
-                                                                       localMemAllocs[allocation->getRootDeviceIndex()].end(),
-                                                                       allocation),
-                                                           localMemAllocs[allocation->getRootDeviceIndex()].end());
+    removeRegisteredAllocation(sysMemAllocs, sysMemAllocsIndices, allocation);
+    removeRegisteredAllocation(localMemAllocs[rootDeviceIndex], localMemAllocsIndices[rootDeviceIndex], allocation);
+}
+
+void DrmMemoryManager::addRegisteredAllocation(std::vector<GraphicsAllocation *> &allocations, std::unordered_map<GraphicsAllocation *, size_t> &indices, GraphicsAllocation *allocation) {
+    if (indices.emplace(allocation, allocations.size()).second) {
+        allocations.push_back(allocation);
+    }
+}
+
+void DrmMemoryManager::removeRegisteredAllocation(std::vector<GraphicsAllocation *> &allocations, std::unordered_map<GraphicsAllocation *, size_t> &indices, GraphicsAllocation *allocation) {
+    auto indexEntry = indices.find(allocation);
+    if (indexEntry == indices.end()) {
+        return;
+    }
+    auto index = indexEntry->second;
+    indices.erase(indexEntry);
+
+    if (index != allocations.size() - 1) {
+        allocations[index] = allocations.back();
+        indices[allocations[index]] = index;
+    }
+    allocations.pop_back();
 }
 
 void DrmMemoryManager::registerAllocationInOs(GraphicsAllocation *allocation) {
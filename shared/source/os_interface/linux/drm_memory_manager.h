@@ -13,6 +13,7 @@
 #include <map>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <unordered_map>
 
 namespace NEO {
 class BufferObject;
@@ -72,6 +73,8 @@ class DrmMemoryManager : public MemoryManager {
     AddressRange reserveGpuAddressOnHeap(const uint64_t requiredStartAddress, size_t size, RootDeviceIndicesContainer rootDeviceIndices, uint32_t *reservedOnRootDeviceIndex, HeapIndex heap, size_t alignment) override;
     size_t selectAlignmentAndHeap(size_t size, HeapIndex *heap) override;
     void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) override;
+    void startBatchedGpuRangeRelease() override;
+    void endBatchedGpuRangeRelease() override;
     MOCKABLE_VIRTUAL BufferObject *createBufferObjectInMemoryRegion(uint32_t rootDeviceIndex, Gmm *gmm, AllocationType allocationType, uint64_t gpuAddress, size_t size,
                                                                     uint32_t memoryBanks, size_t maxOsContextCount, int32_t pairHandle, bool isSystemMemoryPool, bool isUsmHostAllocation);
 
@@ -149,6 +152,8 @@ class DrmMemoryManager : public MemoryManager {
     void waitOnCompletionFence(GraphicsAllocation *allocation);
     bool allocationTypeForCompletionFence(AllocationType allocationType);
     bool makeAllocationResident(GraphicsAllocation *allocation);
+    static void addRegisteredAllocation(std::vector<GraphicsAllocation *> &allocations, std::unordered_map<GraphicsAllocation *, size_t> &indices, GraphicsAllocation *allocation);
+    static void removeRegisteredAllocation(std::vector<GraphicsAllocation *> &allocations, std::unordered_map<GraphicsAllocation *, size_t> &indices, GraphicsAllocation *allocation);
 
     inline std::unique_ptr<Gmm> makeGmmIfSingleHandle(const AllocationData &allocationData, size_t sizeAligned);
     inline std::unique_ptr<DrmAllocation> makeDrmAllocation(const AllocationData &allocationData, std::unique_ptr<Gmm> gmm, uint64_t gpuAddress, size_t sizeAligned);
@@ -172,6 +177,9 @@ class DrmMemoryManager : public MemoryManager {
     std::map<int, BufferObjectHandleWrapper> sharedBoHandles;
     std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
     std::vector<GraphicsAllocation *> sysMemAllocs;
+    // positions of registered allocations in sysMemAllocs/localMemAllocs, allow unregistering in constant time
+    std::vector<std::unordered_map<GraphicsAllocation *, size_t>> localMemAllocsIndices;
+    std::unordered_map<GraphicsAllocation *, size_t> sysMemAllocsIndices;
     std::mutex allocMutex;
 };
 } // namespace NEO
@@ -21,6 +21,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/cache_info.h"
@@ -29,6 +30,7 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
@@ -628,6 +630,15 @@ std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     query.itemsPtr = reinterpret_cast<uint64_t>(&queryItem);
     query.numItems = 1;
 
+    auto useQueryCache = queryCache && isQueryCacheable(queryId);
+    if (useQueryCache) {
+        if (auto cachedData = queryCache->get(queryId, queryItemFlags)) {
+            auto data = std::vector<DataType>(Math::divideAndRoundUp(cachedData->size(), sizeof(DataType)), 0);
+            memcpy(data.data(), cachedData->data(), cachedData->size());
+            return data;
+        }
+    }
+
     auto ret = ioctlHelper->ioctl(DrmIoctl::query, &query);
     if (ret != 0 || queryItem.length <= 0) {
         return {};
@@ -640,9 +651,68 @@ std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     if (ret != 0 || queryItem.length <= 0) {
         return {};
     }
+    if (useQueryCache) {
+        queryCache->store(queryId, queryItemFlags, data.data(), std::min(static_cast<size_t>(queryItem.length), data.size() * sizeof(DataType)));
+    }
     return data;
 }
 
+bool Drm::isQueryCacheable(uint32_t queryId) const {
+    // only results which are constant for given device and kernel driver can be cached,
+    // memory regions report current usage and are always queried
+    for (auto param : {DrmParam::queryEngineInfo, DrmParam::queryTopologyInfo, DrmParam::queryComputeSlices, DrmParam::queryHwconfigTable}) {
+        if (static_cast<uint32_t>(ioctlHelper->getDrmParamValue(param)) == queryId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string Drm::getQueryCacheKey() {
+    // pci path alone may be reused by a different device after a hardware change
+    auto &platform = rootDeviceEnvironment.getHardwareInfo()->platform;
+    std::string cacheKey = hwDeviceId->getPciPath();
+    cacheKey += ";" + std::to_string(platform.usDeviceID) + "." + std::to_string(platform.usRevId);
+
+    DrmVersion version = {};
+    char name[5] = {};
+    version.name = name;
+    version.nameLen = 4;
+    if (SysCalls::ioctl(hwDeviceId->getFileDescriptor(), getIoctlRequestValue(DrmIoctl::version, nullptr), &version) != 0) {
+        return {};
+    }
+    cacheKey += std::string(";") + name + " " + std::to_string(version.versionMajor) + "." + std::to_string(version.versionMinor) + "." + std::to_string(version.versionPatch);
+
+    std::string kernelRelease;
+    std::ifstream ifs("/proc/sys/kernel/osrelease", std::ifstream::in);
+    if (ifs.fail()) {
+        return {};
+    }
+    std::getline(ifs, kernelRelease);
+    cacheKey += ";" + kernelRelease + ";" + driverVersion;
+    return cacheKey;
+}
+
+void Drm::setupQueryCache() {
+    auto cacheDirectory = debugManager.flags.DrmQueryCacheDirectory.get();
+    if (cacheDirectory == "unk" || !ioctlHelper) {
+        return;
+    }
+    auto cacheKey = getQueryCacheKey();
+    if (cacheKey.empty()) {
+        return;
+    }
+    queryCache = std::make_unique<DrmQueryCache>(DrmQueryCache::getFilePath(cacheDirectory, hwDeviceId->getPciPath()), cacheKey);
+    queryCache->load();
+}
+
+void Drm::saveQueryCache() {
+    if (queryCache) {
+        queryCache->save();
+        queryCache.reset();
+    }
+}
+
 void Drm::printIoctlStatistics() {
     if (!debugManager.flags.PrintIoctlTimes.get()) {
         return;
@@ -46,6 +46,7 @@ enum class SubmissionStatus : uint32_t;
 class BufferObject;
 class ReleaseHelper;
 class DeviceFactory;
+class DrmQueryCache;
 class MemoryInfo;
 class OsContext;
 class OsContextLinux;
@@ -257,6 +258,9 @@ class Drm : public DriverModel {
     std::vector<DataType> query(uint32_t queryId, uint32_t queryItemFlags);
     static std::string getDrmVersion(int fileDescriptor);
 
+    void setupQueryCache();
+    void saveQueryCache();
+
   protected:
     Drm(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceIdIn, RootDeviceEnvironment &rootDeviceEnvironment);
 
@@ -268,6 +272,8 @@ class Drm : public DriverModel {
     void queryAndSetVmBindPatIndexProgrammingSupport();
     bool queryDeviceIdAndRevision();
     bool queryI915DeviceIdAndRevision();
+    bool isQueryCacheable(uint32_t queryId) const;
+    MOCKABLE_VIRTUAL std::string getQueryCacheKey();
 
 #pragma pack(1)
     struct PCIConfig {
@@ -320,6 +326,7 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQueryCache> queryCache;
 
     std::once_flag checkBindOnce;
     std::once_flag checkSetPairOnce;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+std::string DrmQueryCache::getFilePath(const std::string &directory, const std::string &pciPath) {
+    std::string fileName = "drm_query_cache_" + pciPath + ".bin";
+    std::replace_if(
+        fileName.begin(), fileName.end(), [](char c) { return c == '/' || c == ':'; }, '_');
+    return joinPath(directory, fileName);
+}
+
+bool DrmQueryCache::load() {
+    size_t fileSize = 0;
+    auto fileData = loadDataFromFile(filePath.c_str(), fileSize);
+    if (fileData == nullptr) {
+        return false;
+    }
+
+    auto invalidate = [this]() {
+        entries.clear();
+        return false;
+    };
+
+    const char *ptr = fileData.get();
+    const char *end = ptr + fileSize;
+
+    FileHeader fileHeader = {};
+    if (static_cast<size_t>(end - ptr) < sizeof(fileHeader)) {
+        return invalidate();
+    }
+    memcpy(&fileHeader, ptr, sizeof(fileHeader));
+    ptr += sizeof(fileHeader);
+
+    if (fileHeader.magic != magicValue || fileHeader.version != currentVersion ||
+        fileHeader.keySize != key.size() || static_cast<size_t>(end - ptr) < fileHeader.keySize ||
+        0 != memcmp(ptr, key.data(), key.size())) {
+        return invalidate();
+    }
+    ptr += fileHeader.keySize;
+
+    for (uint32_t i = 0; i < fileHeader.entryCount; i++) {
+        EntryHeader entryHeader = {};
+        if (static_cast<size_t>(end - ptr) < sizeof(entryHeader)) {
+            return invalidate();
+        }
+        memcpy(&entryHeader, ptr, sizeof(entryHeader));
+        ptr += sizeof(entryHeader);
+
+        if (static_cast<size_t>(end - ptr) < entryHeader.dataSize) {
+            return invalidate();
+        }
+        entries[{entryHeader.queryId, entryHeader.queryItemFlags}].assign(ptr, ptr + entryHeader.dataSize);
+        ptr += entryHeader.dataSize;
+    }
+    return true;
+}
+
+bool DrmQueryCache::save() {
+    if (!modified) {
+        return true;
+    }
+
+    std::vector<char> fileData;
+    auto append = [&fileData](const void *data, size_t size) {
+        auto bytes = reinterpret_cast<const char *>(data);
+        fileData.insert(fileData.end(), bytes, bytes + size);
+    };
+
+    FileHeader fileHeader = {magicValue, currentVersion, static_cast<uint32_t>(key.size()), static_cast<uint32_t>(entries.size())};
+    append(&fileHeader, sizeof(fileHeader));
+    append(key.data(), key.size());
+    for (auto &[query, data] : entries) {
+        EntryHeader entryHeader = {query.first, query.second, static_cast<uint32_t>(data.size()), 0u};
+        append(&entryHeader, sizeof(entryHeader));
+        append(data.data(), data.size());
+    }
+
+    // other processes may read the cache concurrently, file is replaced atomically
+    auto tmpFilePath = filePath + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+    if (writeDataToFile(tmpFilePath.c_str(), fileData.data(), fileData.size()) != fileData.size()) {
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+    if (SysCalls::rename(tmpFilePath.c_str(), filePath.c_str()) != 0) {
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+
+    modified = false;
+    return true;
+}
+
+const std::vector<uint8_t> *DrmQueryCache::get(uint32_t queryId, uint32_t queryItemFlags) const {
+    auto it = entries.find({queryId, queryItemFlags});
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void DrmQueryCache::store(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize) {
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    entries[{queryId, queryItemFlags}].assign(bytes, bytes + dataSize);
+    modified = true;
+}
+
+} // namespace NEO
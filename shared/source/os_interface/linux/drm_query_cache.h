@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// On-disk cache of KMD query results which do not change while the system is running.
+// Cache file is valid only for the key it was created with (device, kernel driver and driver build),
+// on any mismatch its content is dropped and results of live queries are stored instead.
+class DrmQueryCache {
+  public:
+    static constexpr uint32_t magicValue = 0x43514452; // "RDQC"
+    static constexpr uint32_t currentVersion = 1;
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t keySize;
+        uint32_t entryCount;
+    };
+
+    struct EntryHeader {
+        uint32_t queryId;
+        uint32_t queryItemFlags;
+        uint32_t dataSize;
+        uint32_t reserved;
+    };
+
+    DrmQueryCache(const std::string &filePath, const std::string &key) : filePath(filePath), key(key) {}
+
+    static std::string getFilePath(const std::string &directory, const std::string &pciPath);
+
+    bool load();
+    bool save();
+
+    const std::vector<uint8_t> *get(uint32_t queryId, uint32_t queryItemFlags) const;
+    void store(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize);
+
+  protected:
+    std::string filePath;
+    std::string key;
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> entries;
+    bool modified = false;
+};
+
+} // namespace NEO
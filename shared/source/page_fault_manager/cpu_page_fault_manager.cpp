@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -21,7 +23,9 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
 
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    auto &pageFaultData = this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain})).first->second;
+    this->initializeChunks(pageFaultData);
+    this->updateTrackedRange();
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -36,13 +40,28 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (!pageFaultData.chunks.empty()) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
             }
         }
         this->memoryData.erase(ptr);
+        this->updateTrackedRange();
+    }
+}
+
+void PageFaultManager::updateTrackedRange() {
+    if (this->memoryData.empty()) {
+        trackedRangeBegin.store(std::numeric_limits<uintptr_t>::max());
+        trackedRangeEnd.store(0u);
+        return;
     }
+    auto &lastAlloc = *this->memoryData.rbegin();
+    trackedRangeBegin.store(reinterpret_cast<uintptr_t>(this->memoryData.begin()->first));
+    trackedRangeEnd.store(reinterpret_cast<uintptr_t>(ptrOffset(lastAlloc.first, lastAlloc.second.size)));
 }
 
 void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
@@ -74,38 +93,154 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
     if (pageFaultData.domain == AllocationDomain::cpu) {
         this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
 
+        if (this->checkFaultHandlerFromPageFaultManager() == false) {
+            this->registerFaultHandler();
+        }
+
+        if (pageFaultData.chunks.empty()) {
+            std::chrono::steady_clock::time_point start;
+            std::chrono::steady_clock::time_point end;
+
+            start = std::chrono::steady_clock::now();
+            this->transferToGpu(ptr, pageFaultData.cmdQ);
+            end = std::chrono::steady_clock::now();
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+            if (debugManager.flags.PrintUmdSharedMigration.get()) {
+                printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            }
+        } else {
+            this->migrateChunksToGpuDomain(ptr, pageFaultData);
+        }
+
+        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+    }
+    pageFaultData.domain = AllocationDomain::gpu;
+    std::fill(pageFaultData.chunks.begin(), pageFaultData.chunks.end(), ChunkState::gpu);
+}
+
+void PageFaultManager::migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    auto chunksCount = pageFaultData.chunks.size();
+    size_t chunkIndex = 0;
+    while (chunkIndex < chunksCount) {
+        auto rangeState = pageFaultData.chunks[chunkIndex];
+        if (rangeState != ChunkState::cpuDirty && rangeState != ChunkState::cpuClean) {
+            chunkIndex++;
+            continue;
+        }
+
+        // adjacent chunks in the same state are handled as a single range
+        auto rangeStart = chunkIndex;
+        while (chunkIndex < chunksCount && pageFaultData.chunks[chunkIndex] == rangeState) {
+            chunkIndex++;
+        }
+        auto rangeOffset = rangeStart * pageFaultData.chunkSize;
+        auto rangeSize = std::min(chunkIndex * pageFaultData.chunkSize, pageFaultData.size) - rangeOffset;
+        auto rangePtr = ptrOffset(ptr, rangeOffset);
+
+        if (rangeState == ChunkState::cpuClean) {
+            // GPU copy is still valid, only the CPU transfer state is released
+            this->releaseCleanRange(rangePtr, rangeSize, pageFaultData.cmdQ);
+            continue;
+        }
+
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
 
-        if (this->checkFaultHandlerFromPageFaultManager() == false) {
-            this->registerFaultHandler();
+        start = std::chrono::steady_clock::now();
+        this->transferRangeToGpu(rangePtr, rangeSize, pageFaultData.cmdQ);
+        end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (debugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), rangeSize, elapsedTime / 1e3);
         }
+    }
+}
+
+void PageFaultManager::initializeChunks(PageFaultData &pageFaultData) {
+    if (debugManager.flags.UsmSharedMigrationChunkSize.get() <= 0 ||
+        this->gpuDomainHandler != &PageFaultManager::transferAndUnprotectMemory ||
+        !this->isChunkedMigrationSupported()) {
+        return;
+    }
+
+    auto chunkSize = alignUp(static_cast<size_t>(debugManager.flags.UsmSharedMigrationChunkSize.get() * MemoryConstants::kiloByte), MemoryConstants::pageSize);
+    if (pageFaultData.size <= chunkSize) {
+        return;
+    }
+
+    auto initialState = (pageFaultData.domain == AllocationDomain::cpu) ? ChunkState::cpuDirty : ChunkState::none;
+    pageFaultData.chunkSize = chunkSize;
+    pageFaultData.chunks.assign(Math::divideAndRoundUp(pageFaultData.size, chunkSize), initialState);
+}
+
+void PageFaultManager::handleChunkPageFault(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData) {
+    auto chunkIndex = ptrDiff(faultPtr, allocPtr) / pageFaultData.chunkSize;
+    auto chunkOffset = chunkIndex * pageFaultData.chunkSize;
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    auto &chunkState = pageFaultData.chunks[chunkIndex];
+
+    if (chunkState == ChunkState::gpu) {
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+
         start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
         if (debugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
         }
+    }
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+    if (chunkState == ChunkState::gpu || chunkState == ChunkState::none) {
+        this->allowCPUMemoryReadAccess(chunkPtr, chunkSize);
+        chunkState = ChunkState::cpuClean;
+    } else {
+        // chunk was already readable, fault means CPU writes to it
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+        chunkState = ChunkState::cpuDirty;
+    }
+
+    if (pageFaultData.domain != AllocationDomain::cpu) {
+        if (pageFaultData.domain == AllocationDomain::gpu) {
+            pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+        }
+        pageFaultData.domain = AllocationDomain::cpu;
+        this->setCpuAllocEvictable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+        this->allowCPUMemoryEviction(allocPtr, pageFaultData);
     }
-    pageFaultData.domain = AllocationDomain::gpu;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    if (address < trackedRangeBegin.load() || address >= trackedRangeEnd.load()) {
+        return false;
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.chunks.empty()) {
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+    } else {
+        this->handleChunkPageFault(allocPtr, ptr, pageFaultData);
     }
-    return false;
+    return true;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,11 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <atomic>
+#include <limits>
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -38,11 +41,22 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         gpu,
     };
 
+    // State of a single chunk when allocation is migrated with chunk granularity.
+    // CPU chunks are first made read-only, a second fault marks them dirty and only dirty chunks are copied back to GPU.
+    enum class ChunkState : uint8_t {
+        none,
+        gpu,
+        cpuClean,
+        cpuDirty,
+    };
+
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0;
+        std::vector<ChunkState> chunks;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -51,6 +65,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void allowCPUMemoryReadAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
 
   protected:
@@ -61,6 +76,9 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void releaseCleanRange(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL bool isChunkedMigrationSupported();
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData);
@@ -70,10 +88,20 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void handleChunkPageFault(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData);
+    void initializeChunks(PageFaultData &pageFaultData);
+    void updateTrackedRange();
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    // ordered by allocation address, fault address lookup is logarithmic in the number of allocations
+    std::map<void *, PageFaultData> memoryData;
     SpinLock mtx;
+
+    // bounds of all tracked allocations, read by the fault handler without taking the lock
+    // so faults outside of shared allocations don't contend with allocation creation
+    std::atomic<uintptr_t> trackedRangeBegin{std::numeric_limits<uintptr_t>::max()};
+    std::atomic<uintptr_t> trackedRangeEnd{0u};
 };
 } // namespace NEO
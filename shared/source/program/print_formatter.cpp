@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "print_formatter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/string.h"
 
 #include <iostream>
@@ -22,6 +23,10 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
       stringLiteralMap(stringLiteralMap) {
 
     output.reset(new char[maxSinglePrintStringLength]);
+
+    if (debugManager.flags.PrintfStreamingBufferSize.get() != -1) {
+        streamingBufferSize = static_cast<size_t>(debugManager.flags.PrintfStreamingBufferSize.get());
+    }
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
@@ -32,6 +37,10 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
     read(&printfOutputBufferSizeRead);
     printfOutputBufferSize = std::min(printfOutputBufferSizeRead, printfOutputBufferSize);
 
+    if (streamingBufferSize > 0) {
+        streamingBuffer.reserve(streamingBufferSize + maxSinglePrintStringLength);
+    }
+
     if (usesStringMap) {
         uint32_t stringIndex = 0;
         while (currentOffset + 4 <= printfOutputBufferSize) {
@@ -53,21 +62,68 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
             }
         }
     }
+    flushStreamingBuffer(print);
 }
 
 void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+    const auto &parsedFormatString = getParsedFormatString(formatString);
 
     size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
+    for (const auto &token : parsedFormatString) {
+        auto literalLength = std::min(token.literal.size(), maxSinglePrintStringLength - 1 - cursor);
+        memcpy_s(output.get() + cursor, maxSinglePrintStringLength - cursor, token.literal.c_str(), literalLength);
+        cursor += literalLength;
+
+        if (token.conversion.empty()) {
+            continue;
+        }
+        if (token.isStringConversion)
+            cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token.conversion.c_str());
+        else
+            cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token.conversion.c_str());
+        cursor = std::min(cursor, maxSinglePrintStringLength - 1);
+    }
+    output[maxSinglePrintStringLength - 1] = '\0';
+
+    if (streamingBufferSize == 0) {
+        print(output.get());
+        return;
+    }
+    streamingBuffer.append(output.get());
+    if (streamingBuffer.size() >= streamingBufferSize) {
+        flushStreamingBuffer(print);
+    }
+}
 
+void PrintFormatter::flushStreamingBuffer(const std::function<void(char *)> &print) {
+    if (streamingBuffer.empty()) {
+        return;
+    }
+    print(streamingBuffer.data());
+    streamingBuffer.clear();
+}
+
+const PrintFormatter::ParsedFormatString &PrintFormatter::getParsedFormatString(const char *formatString) {
+    auto parsedEntry = parsedFormatStrings.find(formatString);
+    if (parsedEntry != parsedFormatStrings.end()) {
+        return parsedEntry->second;
+    }
+    auto &parsedFormatString = parsedFormatStrings[formatString];
+    parseFormatString(formatString, parsedFormatString);
+    return parsedFormatString;
+}
+
+void PrintFormatter::parseFormatString(const char *formatString, ParsedFormatString &parsedFormatString) {
+    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+
+    ParsedFormatToken token;
     for (size_t i = 0; i <= length; i++) {
         if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
+            token.literal += escapeChar(formatString[++i]);
         else if (formatString[i] == '%') {
             size_t end = i;
             if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+                token.literal += '%';
                 i++;
                 continue;
             }
@@ -75,21 +131,17 @@ void PrintFormatter::printString(const char *formatString, const std::function<v
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
-
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
+            token.conversion.assign(formatString + i, end - i);
+            token.isStringConversion = (formatString[end - 1] == 's');
+            parsedFormatString.push_back(std::move(token));
+            token = {};
 
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            token.literal += formatString[i];
         }
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
-    print(output.get());
+    parsedFormatString.push_back(std::move(token));
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
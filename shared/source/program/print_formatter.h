@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count); // NOLINT(readability-identifier-naming)
 
@@ -51,11 +52,25 @@ class PrintFormatter {
     void setInitialOffset(uint32_t offset) {
         initialOffset = offset;
     }
+    void setStreamingBufferSize(size_t size) {
+        streamingBufferSize = size;
+    }
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t defaultStreamingBufferSize = 64 * MemoryConstants::kiloByte;
 
   protected:
+    struct ParsedFormatToken {
+        std::string literal;    // text printed before the conversion, with escape sequences resolved
+        std::string conversion; // conversion specification, empty for trailing text
+        bool isStringConversion = false;
+    };
+    using ParsedFormatString = std::vector<ParsedFormatToken>;
+
     const char *queryPrintfString(uint32_t index) const;
+    const ParsedFormatString &getParsedFormatString(const char *formatString);
+    void parseFormatString(const char *formatString, ParsedFormatString &parsedFormatString);
     void printString(const char *formatString, const std::function<void(char *)> &print);
+    void flushStreamingBuffer(const std::function<void(char *)> &print);
     size_t printToken(char *output, size_t size, const char *formatString);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
@@ -125,6 +140,9 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    std::unordered_map<const char *, ParsedFormatString> parsedFormatStrings; // format strings are parsed once per formatter
+    std::string streamingBuffer;
+    size_t streamingBufferSize = defaultStreamingBufferSize;
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
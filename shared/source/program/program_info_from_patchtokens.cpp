@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/kernel_info_from_patchtokens.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_jobs.h"
 
 #include <RelocationInfo.h>
 
@@ -27,12 +28,9 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
+static void addKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum, std::unique_ptr<KernelInfo> kernelInfo) {
     const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
 
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
-
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeExportedFunctionsSymbolTable(decodedKernel.tokens.programSymbolTable + 1, decodedKernel.tokens.programSymbolTable->NumEntries, kernelNum);
@@ -50,9 +48,37 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
     dst.kernelInfos.push_back(kernelInfo.release());
 }
 
+void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
+    auto kernelInfo = std::make_unique<KernelInfo>();
+    NEO::populateKernelInfo(*kernelInfo, decodedProgram.kernels[kernelNum], decodedProgram.header->GPUPointerSizeInBytes);
+    addKernelInfo(dst, decodedProgram, kernelNum, std::move(kernelInfo));
+}
+
+// Kernel infos depend only on tokens of their own kernel and are populated concurrently. Program level data
+// (linker input, host access table and order of kernel infos) is filled sequentially afterwards.
+static void populateKernelInfosInParallel(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t maxThreads) {
+    const auto kernelCount = static_cast<uint32_t>(decodedProgram.kernels.size());
+    std::vector<std::unique_ptr<KernelInfo>> kernelInfos(kernelCount);
+
+    runParallelJobs(kernelCount, maxThreads, [&](size_t kernelNum) {
+        kernelInfos[kernelNum] = std::make_unique<KernelInfo>();
+        NEO::populateKernelInfo(*kernelInfos[kernelNum], decodedProgram.kernels[kernelNum], decodedProgram.header->GPUPointerSizeInBytes);
+    });
+
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelCount);
+    for (auto kernelNum = 0u; kernelNum < kernelCount; kernelNum++) {
+        addKernelInfo(dst, decodedProgram, kernelNum, std::move(kernelInfos[kernelNum]));
+    }
+}
+
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
-    for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+    auto maxPopulateThreads = debugManager.flags.ParallelPatchtokensKernelInfoPopulation.get();
+    if (maxPopulateThreads > 1 && src.kernels.size() > 1) {
+        populateKernelInfosInParallel(dst, src, static_cast<uint32_t>(maxPopulateThreads));
+    } else {
+        for (uint32_t i = 0; i < src.kernels.size(); ++i) {
+            populateSingleKernelInfo(dst, src, i);
+        }
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
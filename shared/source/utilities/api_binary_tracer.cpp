@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_binary_tracer.h"
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace NEO {
+
+struct ApiBinaryTraceThreadBuffer {
+    ~ApiBinaryTraceThreadBuffer() {
+        ApiBinaryTracer::releaseThreadBuffer(*this);
+    }
+
+    std::mutex recordsMutex;
+    ApiBinaryTracer *owner = nullptr;
+    uint32_t threadId = 0;
+    uint64_t nextCorrelationId = 0;
+    std::vector<ApiBinaryTraceRecord> records;
+};
+
+thread_local ApiBinaryTraceThreadBuffer apiBinaryTraceThreadBuffer;
+
+std::mutex ApiBinaryTracer::threadBuffersMutex;
+
+ApiBinaryTracer::ApiBinaryTracer(std::ostream &output) {
+    ApiBinaryTraceFileHeader header = {ApiBinaryTraceFileHeader::magicValue, ApiBinaryTraceFileHeader::currentVersion, sizeof(ApiBinaryTraceRecord), 0u};
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    constexpr size_t maxQueuedBlocks = 16;
+    writer = std::make_unique<AsyncFileWriter>(output, recordsPerThreadBuffer * sizeof(ApiBinaryTraceRecord), maxQueuedBlocks);
+}
+
+// Threads owning the buffers may still be running or exiting, each buffer is flushed under its own lock
+// and orphaned so that its thread neither writes to it nor detaches it from this tracer later.
+ApiBinaryTracer::~ApiBinaryTracer() {
+    {
+        std::lock_guard<std::mutex> lock(threadBuffersMutex);
+        for (auto buffer : threadBuffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->recordsMutex);
+            writeThreadBuffer(*buffer);
+            buffer->owner = nullptr;
+        }
+        threadBuffers.clear();
+    }
+    writer.reset();
+}
+
+std::unique_ptr<ApiBinaryTracer> ApiBinaryTracer::create(const std::string &fileName) {
+    auto file = std::make_unique<std::ofstream>(fileName, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file->is_open()) {
+        return nullptr;
+    }
+
+    auto tracer = std::make_unique<ApiBinaryTracer>(*file);
+    tracer->ownedOutput = std::move(file);
+    return tracer;
+}
+
+uint64_t ApiBinaryTracer::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void ApiBinaryTracer::record(uint64_t apiId, uint64_t handle, uint64_t startTimestamp, uint64_t endTimestamp, int32_t result) {
+    auto &buffer = apiBinaryTraceThreadBuffer;
+    std::unique_lock<std::mutex> bufferLock(buffer.recordsMutex);
+    if (buffer.owner != this) {
+        bufferLock.unlock();
+        attachThreadBuffer(buffer);
+        bufferLock.lock();
+    }
+
+    buffer.records.push_back({apiId, handle, buffer.nextCorrelationId++, startTimestamp, endTimestamp, buffer.threadId, result});
+    if (buffer.records.size() >= recordsPerThreadBuffer) {
+        writeThreadBuffer(buffer);
+    }
+}
+
+void ApiBinaryTracer::attachThreadBuffer(ApiBinaryTraceThreadBuffer &buffer) {
+    constexpr uint32_t correlationIdThreadShift = 40;
+
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    std::lock_guard<std::mutex> bufferLock(buffer.recordsMutex);
+    if (buffer.owner) {
+        buffer.owner->detachThreadBuffer(buffer);
+    }
+    buffer.owner = this;
+    buffer.threadId = nextThreadId++;
+    buffer.nextCorrelationId = static_cast<uint64_t>(buffer.threadId) << correlationIdThreadShift;
+    buffer.records.reserve(recordsPerThreadBuffer);
+    threadBuffers.push_back(&buffer);
+}
+
+void ApiBinaryTracer::releaseThreadBuffer(ApiBinaryTraceThreadBuffer &buffer) {
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    std::lock_guard<std::mutex> bufferLock(buffer.recordsMutex);
+    if (buffer.owner) {
+        buffer.owner->detachThreadBuffer(buffer);
+    }
+}
+
+// Caller holds threadBuffersMutex and the buffer lock, the owner is alive until it removes the buffer itself.
+void ApiBinaryTracer::detachThreadBuffer(ApiBinaryTraceThreadBuffer &buffer) {
+    writeThreadBuffer(buffer);
+    threadBuffers.erase(std::remove(threadBuffers.begin(), threadBuffers.end(), &buffer), threadBuffers.end());
+    buffer.owner = nullptr;
+}
+
+void ApiBinaryTracer::writeThreadBuffer(ApiBinaryTraceThreadBuffer &buffer) {
+    if (buffer.records.empty()) {
+        return;
+    }
+    writer->write(reinterpret_cast<const char *>(buffer.records.data()), buffer.records.size() * sizeof(ApiBinaryTraceRecord));
+    buffer.records.clear();
+}
+
+} // namespace NEO
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class AsyncFileWriter;
+
+struct ApiBinaryTraceFileHeader {
+    static constexpr uint32_t magicValue = 0x54424150; // "PABT"
+    static constexpr uint32_t currentVersion = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t reserved;
+};
+
+// Fixed size record stored for every traced API call, apiId meaning is defined by the API layer using the tracer.
+// Correlation id is unique per process, upper 24 bits hold the thread id.
+// Result is noResult when the call returned no status code, e.g. a create call made without errcodeRet.
+struct ApiBinaryTraceRecord {
+    static constexpr int32_t noResult = std::numeric_limits<int32_t>::min();
+
+    uint64_t apiId;
+    uint64_t handle;
+    uint64_t correlationId;
+    uint64_t startTimestamp;
+    uint64_t endTimestamp;
+    uint32_t threadId;
+    int32_t result;
+};
+static_assert(sizeof(ApiBinaryTraceRecord) == 48, "binary trace record layout is part of the file format");
+
+struct ApiBinaryTraceThreadBuffer;
+
+// Records are appended to a per-thread buffer guarded by its own uncontended lock, full buffers are handed
+// over to a background writer. Ownership of thread buffers is changed only under the process-wide
+// threadBuffersMutex, so an exiting thread and a tracer being destroyed never flush the same buffer twice.
+class ApiBinaryTracer : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t recordsPerThreadBuffer = 1024;
+
+    ApiBinaryTracer(std::ostream &output);
+    ~ApiBinaryTracer();
+
+    static std::unique_ptr<ApiBinaryTracer> create(const std::string &fileName);
+    static uint64_t getTimestamp();
+
+    void record(uint64_t apiId, uint64_t handle, uint64_t startTimestamp, uint64_t endTimestamp, int32_t result);
+    static void releaseThreadBuffer(ApiBinaryTraceThreadBuffer &buffer);
+
+  protected:
+    void attachThreadBuffer(ApiBinaryTraceThreadBuffer &buffer);
+    void detachThreadBuffer(ApiBinaryTraceThreadBuffer &buffer);
+    void writeThreadBuffer(ApiBinaryTraceThreadBuffer &buffer);
+
+    std::unique_ptr<std::ostream> ownedOutput;
+    std::unique_ptr<AsyncFileWriter> writer;
+
+    static std::mutex threadBuffersMutex;
+    std::vector<ApiBinaryTraceThreadBuffer *> threadBuffers;
+    uint32_t nextThreadId = 0;
+};
+
+} // namespace NEO
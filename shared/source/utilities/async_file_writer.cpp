@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+AsyncFileWriter::AsyncFileWriter(std::ostream &output, size_t blockSize, size_t maxQueuedBlocks)
+    : output(output), blockSize(std::max(blockSize, static_cast<size_t>(1u))), maxQueuedBlocks(std::max(maxQueuedBlocks, static_cast<size_t>(1u))) {
+    currentBlock.reserve(this->blockSize);
+    writerThread = Thread::create(processBlocks, reinterpret_cast<void *>(this));
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    drain();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        keepRunning.store(false);
+    }
+    blockQueued.notify_one();
+
+    writerThread->join();
+    writerThread.reset();
+}
+
+void AsyncFileWriter::write(const char *data, size_t size) {
+    std::lock_guard<std::mutex> producerLock(producerMutex);
+    while (size > 0) {
+        auto sizeToCopy = std::min(size, blockSize - currentBlock.size());
+        currentBlock.insert(currentBlock.end(), data, data + sizeToCopy);
+        data += sizeToCopy;
+        size -= sizeToCopy;
+
+        if (currentBlock.size() == blockSize) {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCurrentBlock(lock);
+        }
+    }
+}
+
+void AsyncFileWriter::flush() {
+    std::lock_guard<std::mutex> producerLock(producerMutex);
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (!currentBlock.empty()) {
+        queueCurrentBlock(lock);
+    }
+}
+
+void AsyncFileWriter::drain() {
+    std::lock_guard<std::mutex> producerLock(producerMutex);
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (!currentBlock.empty()) {
+        queueCurrentBlock(lock);
+    }
+    blockWritten.wait(lock, [this]() { return queuedBlocks.empty() && !blockInProgress; });
+    output.flush();
+}
+
+void AsyncFileWriter::queueCurrentBlock(std::unique_lock<std::mutex> &lock) {
+    blockWritten.wait(lock, [this]() { return queuedBlocks.size() < maxQueuedBlocks; });
+
+    queuedBlocks.push_back(std::move(currentBlock));
+    if (freeBlocks.empty()) {
+        currentBlock = {};
+        currentBlock.reserve(blockSize);
+    } else {
+        currentBlock = std::move(freeBlocks.back());
+        freeBlocks.pop_back();
+    }
+    blockQueued.notify_one();
+}
+
+void *AsyncFileWriter::processBlocks(void *self) {
+    auto writer = reinterpret_cast<AsyncFileWriter *>(self);
+
+    std::unique_lock<std::mutex> lock(writer->queueMutex);
+    while (true) {
+        writer->blockQueued.wait(lock, [writer]() { return !writer->keepRunning.load() || !writer->queuedBlocks.empty(); });
+        if (writer->queuedBlocks.empty()) {
+            break;
+        }
+
+        auto block = std::move(writer->queuedBlocks.front());
+        writer->queuedBlocks.pop_front();
+        writer->blockInProgress = true;
+        lock.unlock();
+
+        writer->output.write(block.data(), block.size());
+        block.clear();
+
+        lock.lock();
+        writer->freeBlocks.push_back(std::move(block));
+        writer->blockInProgress = false;
+        writer->blockWritten.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
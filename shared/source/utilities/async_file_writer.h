@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Moves writes to an output stream off the calling thread. Data is gathered into blocks of blockSize bytes,
+// full blocks are queued and written by a background thread. At most maxQueuedBlocks blocks wait in the queue,
+// a writer producing data faster than it can be stored is throttled instead of growing memory usage.
+class AsyncFileWriter : NonCopyableOrMovableClass {
+  public:
+    AsyncFileWriter(std::ostream &output, size_t blockSize, size_t maxQueuedBlocks);
+    virtual ~AsyncFileWriter();
+
+    void write(const char *data, size_t size);
+    void flush();
+    void drain();
+
+  protected:
+    static void *processBlocks(void *self);
+    void queueCurrentBlock(std::unique_lock<std::mutex> &lock);
+
+    std::ostream &output;
+    const size_t blockSize;
+    const size_t maxQueuedBlocks;
+
+    // filled by producers without holding queueMutex, it is only taken to hand a full block over to writer thread
+    std::vector<char> currentBlock;
+    std::deque<std::vector<char>> queuedBlocks;
+    std::vector<std::vector<char>> freeBlocks;
+    bool blockInProgress = false;
+
+    // serializes callers, data passed to a single write() call is never interleaved with other writes
+    std::mutex producerMutex;
+    std::mutex queueMutex;
+    std::condition_variable blockQueued;
+    std::condition_variable blockWritten;
+    std::unique_ptr<Thread> writerThread;
+    std::atomic_bool keepRunning = true;
+};
+
+} // namespace NEO
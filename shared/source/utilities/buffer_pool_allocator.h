@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,18 @@ struct SmallBuffersParams {
     static constexpr auto startingOffset = chunkAlignment;
 };
 
+// Size class of the pooled buffers: requests not larger than `maxBufferSize` are
+// suballocated from pools of `poolSize` bytes, pools are added to a tier on demand.
+struct SmallBuffersPoolTier {
+    size_t maxBufferSize;
+    size_t poolSize;
+};
+
+struct SmallBuffersPoolTierStatistics {
+    uint64_t poolHits = 0u;
+    uint64_t poolMisses = 0u;
+};
+
 template <typename PoolT, typename BufferType, typename BufferParentType = BufferType>
 struct AbstractBuffersPool : public SmallBuffersParams<PoolT>, public NonCopyableClass {
     // The prototype of a function allocating the `mainStorage` is not specified.
@@ -64,6 +76,7 @@ struct AbstractBuffersPool : public SmallBuffersParams<PoolT>, public NonCopyabl
     std::unique_ptr<HeapAllocator> chunkAllocator;
     std::vector<std::pair<uint64_t, size_t>> chunksToFree;
     OnChunkFreeCallback onChunkFreeCallback = nullptr;
+    uint32_t tierIndex = 0u;
 };
 
 template <typename BuffersPoolType, typename BufferType, typename BufferParentType = BufferType>
@@ -82,16 +95,25 @@ class AbstractBuffersAllocator : public SmallBuffersParams<BuffersPoolType> {
     void releaseSmallBufferPool() { this->bufferPools.clear(); }
     bool isPoolBuffer(const BufferParentType *buffer) const;
     void tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size);
+    void setPoolTiers(const std::vector<SmallBuffersPoolTier> &tiers);
+    const std::vector<SmallBuffersPoolTier> &getPoolTiers() const { return this->poolTiers; }
+    SmallBuffersPoolTierStatistics getPoolTierStatistics(uint32_t tierIndex);
 
   protected:
-    inline bool isSizeWithinThreshold(size_t size) const { return smallBufferThreshold >= size; }
+    inline bool isSizeWithinThreshold(size_t size) const { return this->poolTiers.back().maxBufferSize >= size; }
+    uint32_t getPoolTierIndex(size_t size) const;
     void tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size, std::vector<BuffersPoolType> &bufferPoolsVec);
     void drain();
     void drain(std::vector<BuffersPoolType> &bufferPoolsVec);
+    void drainPoolTier(uint32_t tierIndex);
     void addNewBufferPool(BuffersPoolType &&bufferPool);
     void addNewBufferPool(BuffersPoolType &&bufferPool, std::vector<BuffersPoolType> &bufferPoolsVec);
+    void registerPoolTierAllocation(uint32_t tierIndex, bool poolHit);
 
     std::mutex mutex;
     std::vector<BuffersPoolType> bufferPools;
+    std::vector<SmallBuffersPoolTier> poolTiers{{smallBufferThreshold, aggregatedSmallBuffersPoolSize}};
+    std::vector<SmallBuffersPoolTierStatistics> poolTierStatistics{1u};
+    bool drainOnFree = false;
 };
 } // namespace NEO
@@ -1,14 +1,16 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/buffer_pool_allocator.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace NEO {
@@ -24,7 +26,8 @@ AbstractBuffersPool<PoolT, BufferType, BufferParentType>::AbstractBuffersPool(Ab
     : memoryManager{bufferPool.memoryManager},
       mainStorage{std::move(bufferPool.mainStorage)},
       chunkAllocator{std::move(bufferPool.chunkAllocator)},
-      onChunkFreeCallback{bufferPool.onChunkFreeCallback} {}
+      onChunkFreeCallback{bufferPool.onChunkFreeCallback},
+      tierIndex{bufferPool.tierIndex} {}
 
 template <typename PoolT, typename BufferType, typename BufferParentType>
 void AbstractBuffersPool<PoolT, BufferType, BufferParentType>::tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size) {
@@ -79,6 +82,49 @@ void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::tr
     auto lock = std::unique_lock<std::mutex>(this->mutex);
     for (auto &bufferPool : bufferPoolsVec) {
         bufferPool.tryFreeFromPoolBuffer(possiblePoolBuffer, offset, size); // NOLINT(clang-analyzer-cplusplus.NewDelete)
+        if (this->drainOnFree && bufferPool.isPoolBuffer(possiblePoolBuffer)) {
+            bufferPool.drain();
+        }
+    }
+}
+
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::setPoolTiers(const std::vector<SmallBuffersPoolTier> &tiers) {
+    UNRECOVERABLE_IF(tiers.empty());
+    UNRECOVERABLE_IF(!std::is_sorted(tiers.begin(), tiers.end(), [](const auto &lhs, const auto &rhs) { return lhs.maxBufferSize < rhs.maxBufferSize; }));
+
+    auto lock = std::unique_lock<std::mutex>(this->mutex);
+    this->poolTiers = tiers;
+    this->poolTierStatistics.clear();
+    this->poolTierStatistics.resize(tiers.size());
+}
+
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+SmallBuffersPoolTierStatistics AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::getPoolTierStatistics(uint32_t tierIndex) {
+    auto lock = std::unique_lock<std::mutex>(this->mutex);
+    if (tierIndex >= this->poolTierStatistics.size()) {
+        return {};
+    }
+    return this->poolTierStatistics[tierIndex];
+}
+
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+uint32_t AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::getPoolTierIndex(size_t size) const {
+    for (auto tierIndex = 0u; tierIndex < this->poolTiers.size(); tierIndex++) {
+        if (this->poolTiers[tierIndex].maxBufferSize >= size) {
+            return tierIndex;
+        }
+    }
+    return static_cast<uint32_t>(this->poolTiers.size());
+}
+
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::registerPoolTierAllocation(uint32_t tierIndex, bool poolHit) {
+    auto &statistics = this->poolTierStatistics[tierIndex];
+    if (poolHit) {
+        statistics.poolHits++;
+    } else {
+        statistics.poolMisses++;
     }
 }
 
@@ -94,6 +140,15 @@ void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::dr
     }
 }
 
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::drainPoolTier(uint32_t tierIndex) {
+    for (auto &bufferPool : this->bufferPools) {
+        if (bufferPool.tierIndex == tierIndex) {
+            bufferPool.drain();
+        }
+    }
+}
+
 template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
 void AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::addNewBufferPool(BuffersPoolType &&bufferPool) {
     this->addNewBufferPool(std::move(bufferPool), this->bufferPools);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/counter_wait_service.h"
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/wait_util.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+CounterWaitService::~CounterWaitService() {
+    {
+        std::lock_guard<std::mutex> lock(waitersMutex);
+        keepRunning.store(false);
+    }
+    serviceCondition.notify_one();
+
+    if (serviceThread) {
+        serviceThread->join();
+        serviceThread.reset();
+    }
+}
+
+bool CounterWaitService::waitForValue(volatile const uint64_t *address, uint64_t targetValue, std::chrono::microseconds timeout) {
+    if (*address >= targetValue) {
+        return true;
+    }
+
+    Waiter waiter;
+    waiter.address = address;
+    waiter.targetValue = targetValue;
+
+    std::unique_lock<std::mutex> lock(waitersMutex);
+    if (!serviceThread) {
+        serviceThread = Thread::create(processWaiters, reinterpret_cast<void *>(this));
+    }
+    waiters.push_back(&waiter);
+    serviceCondition.notify_one();
+
+    waiter.condition.wait_for(lock, timeout, [&waiter]() { return waiter.signaled; });
+    waiter.unregistering = true;
+    monitorFinished.wait(lock, [this, &waiter]() { return monitoredWaiter != &waiter; });
+    waiters.erase(std::find(waiters.begin(), waiters.end(), &waiter));
+
+    return waiter.signaled || *address >= targetValue;
+}
+
+const CounterWaitService::Waiter *CounterWaitService::signalCompletedWaiters() {
+    const Waiter *nextWaiter = nullptr;
+    for (auto &waiter : waiters) {
+        if (waiter->signaled || waiter->unregistering) {
+            continue;
+        }
+        if (*waiter->address >= waiter->targetValue) {
+            waiter->signaled = true;
+            waiter->condition.notify_one();
+            continue;
+        }
+        if (nextWaiter == nullptr || waiter->targetValue < nextWaiter->targetValue) {
+            nextWaiter = waiter;
+        }
+    }
+    return nextWaiter;
+}
+
+void CounterWaitService::waitForCounterChange(volatile const uint64_t *address, uint64_t targetValue, uint32_t idleIterations) {
+    for (uint32_t i = 0; i < WaitUtils::waitCount; i++) {
+        CpuIntrinsics::pause();
+    }
+    if (*address >= targetValue) {
+        return;
+    }
+    if (WaitUtils::waitpkgUse) {
+        WaitUtils::monitorWait(address, 0);
+        return;
+    }
+    if (idleIterations >= idleIterationsBeforeSleep) {
+        auto backoffShift = std::min(idleIterations - idleIterationsBeforeSleep, 7u);
+        auto sleepTime = std::min(std::chrono::microseconds(1u << backoffShift), maxBackoffSleep);
+        std::this_thread::sleep_for(sleepTime);
+    }
+}
+
+void *CounterWaitService::processWaiters(void *self) {
+    auto service = reinterpret_cast<CounterWaitService *>(self);
+
+    const Waiter *previousWaiter = nullptr;
+    uint32_t idleIterations = 0u;
+
+    std::unique_lock<std::mutex> lock(service->waitersMutex);
+    while (service->keepRunning.load()) {
+        auto nextWaiter = service->signalCompletedWaiters();
+        if (nextWaiter != previousWaiter) {
+            idleIterations = 0u;
+            previousWaiter = nextWaiter;
+        }
+        if (nextWaiter == nullptr) {
+            service->serviceCondition.wait(lock, [service]() {
+                return !service->keepRunning.load() ||
+                       std::any_of(service->waiters.begin(), service->waiters.end(), [](const Waiter *waiter) { return !waiter->signaled && !waiter->unregistering; });
+            });
+            continue;
+        }
+
+        // waiters can register and leave while the counter is monitored, only the monitored one waits for its end
+        service->monitoredWaiter = nextWaiter;
+        auto address = nextWaiter->address;
+        auto targetValue = nextWaiter->targetValue;
+        lock.unlock();
+
+        service->waitForCounterChange(address, targetValue, idleIterations++);
+        std::this_thread::yield();
+
+        lock.lock();
+        service->monitoredWaiter = nullptr;
+        service->monitorFinished.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Waits on host-visible monotonic counters (e.g. in-order counter-based event allocations) on behalf of many
+// host threads. A single service thread polls all registered (address, target value) pairs, monitoring the
+// pending waiter with the lowest target, and wakes up only the waiters whose counters reached their targets.
+class CounterWaitService : NonCopyableOrMovableClass {
+  public:
+    CounterWaitService() = default;
+    virtual ~CounterWaitService();
+
+    MOCKABLE_VIRTUAL bool waitForValue(volatile const uint64_t *address, uint64_t targetValue, std::chrono::microseconds timeout);
+
+  protected:
+    struct Waiter {
+        volatile const uint64_t *address = nullptr;
+        uint64_t targetValue = 0u;
+        std::condition_variable condition;
+        bool signaled = false;
+        bool unregistering = false;
+    };
+
+    static void *processWaiters(void *self);
+    const Waiter *signalCompletedWaiters();
+    MOCKABLE_VIRTUAL void waitForCounterChange(volatile const uint64_t *address, uint64_t targetValue, uint32_t idleIterations);
+
+    // without waitpkg the service thread backs off to sleeping, sleep time doubles up to maxBackoffSleep
+    static constexpr uint32_t idleIterationsBeforeSleep = 64u;
+    static constexpr std::chrono::microseconds maxBackoffSleep{128};
+
+    std::vector<Waiter *> waiters;
+    // counter of this waiter is monitored without holding waitersMutex, it cannot be unregistered until monitoring finishes
+    const Waiter *monitoredWaiter = nullptr;
+    std::mutex waitersMutex;
+    std::condition_variable serviceCondition;
+    std::condition_variable monitorFinished;
+    std::unique_ptr<Thread> serviceThread;
+    std::atomic_bool keepRunning = true;
+};
+
+} // namespace NEO
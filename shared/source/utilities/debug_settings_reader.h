@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,9 @@ class SettingsReader {
     virtual std::string getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) = 0;
     virtual std::string getSetting(const char *settingName, const std::string &value) = 0;
     virtual const char *appSpecificLocation(const std::string &name) = 0;
+    // all settings are read between these calls, reader may keep a snapshot of its source meanwhile
+    virtual void beginBatchRead() {}
+    virtual void endBatchRead() {}
     static const char *settingsFileName;
     static const char *neoSettingsFileName;
 };
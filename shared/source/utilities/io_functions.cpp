@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,20 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#if !defined(_WIN32)
+extern char **environ;
+#endif
+
 namespace NEO {
 namespace IoFunctions {
+static char **getEnvironment() {
+#if defined(_WIN32)
+    return _environ;
+#else
+    return environ;
+#endif
+}
+
 fopenFuncPtr fopenPtr = &fopen;
 vfprintfFuncPtr vfprintfPtr = &vfprintf;
 fcloseFuncPtr fclosePtr = &fclose;
@@ -19,5 +31,6 @@ rewindFuncPtr rewindPtr = &rewind;
 freadFuncPtr freadPtr = &fread;
 fwriteFuncPtr fwritePtr = &fwrite;
 fflushFuncPtr fflushPtr = &fflush;
+getEnvironmentFuncPtr getEnvironmentPtr = &getEnvironment;
 } // namespace IoFunctions
 } // namespace NEO
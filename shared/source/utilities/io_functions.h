@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@ using rewindFuncPtr = decltype(&rewind);
 using freadFuncPtr = decltype(&fread);
 using fwriteFuncPtr = decltype(&fwrite);
 using fflushFuncPtr = decltype(&fflush);
+using getEnvironmentFuncPtr = char **(*)();
 
 extern fopenFuncPtr fopenPtr;
 extern vfprintfFuncPtr vfprintfPtr;
@@ -33,6 +34,7 @@ extern rewindFuncPtr rewindPtr;
 extern freadFuncPtr freadPtr;
 extern fwriteFuncPtr fwritePtr;
 extern fflushFuncPtr fflushPtr;
+extern getEnvironmentFuncPtr getEnvironmentPtr;
 
 inline int fprintf(FILE *fileDesc, char const *const formatStr, ...) {
     va_list args;
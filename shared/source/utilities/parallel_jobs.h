@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Parses value of "-j <jobs>" option. Zero (or invalid value) means one job per hardware thread.
+inline size_t parseJobsCount(const std::string &value) {
+    auto jobs = std::atoi(value.c_str());
+    if (jobs > 0) {
+        return static_cast<size_t>(jobs);
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Calls job(index) for each index in [0, jobsCount) using up to workersCount threads.
+// Indices are handed out in ascending order. Callers store results per index and consume them
+// in index order once this function returns, so the outcome does not depend on completion order.
+template <typename JobT>
+void runParallelJobs(size_t jobsCount, size_t workersCount, JobT &&job) {
+    workersCount = std::min(workersCount, jobsCount);
+    if (workersCount <= 1) {
+        for (size_t index = 0; index < jobsCount; ++index) {
+            job(index);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextJob{0};
+    auto worker = [&]() {
+        for (size_t index = nextJob++; index < jobsCount; index = nextJob++) {
+            job(index);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1);
+    for (size_t i = 1; i < workersCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+}
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/test/common/mocks/mock_io_functions.h"
 
+#include <vector>
+
 namespace NEO {
 namespace IoFunctions {
 fopenFuncPtr fopenPtr = &mockFopen;
@@ -19,6 +21,7 @@ rewindFuncPtr rewindPtr = &mockRewind;
 freadFuncPtr freadPtr = &mockFread;
 fwriteFuncPtr fwritePtr = &mockFwrite;
 fflushFuncPtr fflushPtr = &mockFflush;
+getEnvironmentFuncPtr getEnvironmentPtr = &mockGetEnvironment;
 
 uint32_t mockFopenCalled = 0;
 FILE *mockFopenReturned = reinterpret_cast<FILE *>(0x40);
@@ -26,6 +29,7 @@ uint32_t failAfterNFopenCount = 0;
 uint32_t mockVfptrinfCalled = 0;
 uint32_t mockFcloseCalled = 0;
 uint32_t mockGetenvCalled = 0;
+uint32_t mockGetEnvironmentCalled = 0;
 uint32_t mockFseekCalled = 0;
 uint32_t mockFtellCalled = 0;
 long int mockFtellReturn = 0;
@@ -41,5 +45,24 @@ const char *openCLDriverName = "igdrcl.dll";
 
 std::unordered_map<std::string, std::string> *mockableEnvValues = nullptr;
 
+char **mockGetEnvironment() {
+    static std::vector<std::string> mockEnvironmentEntries;
+    static std::vector<char *> mockEnvironment;
+
+    mockGetEnvironmentCalled++;
+    mockEnvironmentEntries.clear();
+    if (mockableEnvValues != nullptr) {
+        for (auto &[name, value] : *mockableEnvValues) {
+            mockEnvironmentEntries.push_back(name + "=" + value);
+        }
+    }
+    mockEnvironment.clear();
+    for (auto &entry : mockEnvironmentEntries) {
+        mockEnvironment.push_back(entry.data());
+    }
+    mockEnvironment.push_back(nullptr);
+    return mockEnvironment.data();
+}
+
 } // namespace IoFunctions
 } // namespace NEO
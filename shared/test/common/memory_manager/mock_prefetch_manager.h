@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,11 +9,20 @@
 
 #include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <atomic>
+#include <thread>
 
 using namespace NEO;
 
 class MockPrefetchManager : public PrefetchManager {
   public:
+    using PrefetchManager::completedRequestsCount;
+    using PrefetchManager::pendingRequestIds;
+    using PrefetchManager::prefetchThread;
+    using PrefetchManager::queuedRequestsCount;
+
     void migrateAllocationsToGpu(PrefetchContext &prefetchContext, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) override {
         PrefetchManager::migrateAllocationsToGpu(prefetchContext, unifiedMemoryManager, device, csr);
         migrateAllocationsToGpuCalled = true;
@@ -24,6 +33,18 @@ class MockPrefetchManager : public PrefetchManager {
         removeAllocationsCalled = true;
     }
 
+    void prefetchBatch(std::vector<PrefetchRequest> &batch) override {
+        prefetchBatchEntered = true;
+        while (blockPrefetchBatch) {
+            std::this_thread::yield();
+        }
+        PrefetchManager::prefetchBatch(batch);
+        prefetchBatchCalled++;
+    }
+
     bool migrateAllocationsToGpuCalled = false;
     bool removeAllocationsCalled = false;
+    uint32_t prefetchBatchCalled = 0;
+    std::atomic_bool prefetchBatchEntered = false;
+    std::atomic_bool blockPrefetchBatch = false;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,11 +62,17 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
 
         return addCommentResult;
     }
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writeMemoryCalledCnt++;
+        writtenMemorySize += size;
+    }
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override {
         registerPollCalled = true;
         AUBCommandStreamReceiver::AubFileStream::registerPoll(registerOffset, mask, value, pollNotEqual, timeoutAction);
     }
     uint32_t addCommentCalled = 0u;
+    uint32_t writeMemoryCalledCnt = 0u;
+    size_t writtenMemorySize = 0u;
     uint32_t openCalledCnt = 0;
     std::string fileName = "";
     bool addCommentResult = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,11 +16,15 @@ using namespace NEO;
 
 class MockPageFaultManager : public PageFaultManager {
   public:
+    using PageFaultManager::ChunkState;
     using PageFaultManager::gpuDomainHandler;
     using PageFaultManager::memoryData;
+    using PageFaultManager::mtx;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::selectGpuDomainHandler;
+    using PageFaultManager::trackedRangeBegin;
+    using PageFaultManager::trackedRangeEnd;
     using PageFaultManager::transferAndUnprotectMemory;
     using PageFaultManager::unprotectAndTransferMemory;
     using PageFaultManager::verifyPageFault;
@@ -42,6 +46,11 @@ class MockPageFaultManager : public PageFaultManager {
         protectedMemoryAccessAddress = ptr;
         protectedSize = size;
     }
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override {
+        allowMemoryReadAccessCalled++;
+        allowedMemoryReadAccessAddress = ptr;
+        readAccessAllowedSize = size;
+    }
     void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
         transferToCpuCalled++;
         transferToCpuAddress = ptr;
@@ -51,6 +60,19 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToGpu(void *ptr, size_t size, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferRangeToGpuAddress = ptr;
+        transferRangeToGpuSize = size;
+    }
+    void releaseCleanRange(void *ptr, size_t size, void *cmdQ) override {
+        releaseCleanRangeCalled++;
+        releasedCleanRangeAddress = ptr;
+        releasedCleanRangeSize = size;
+    }
+    bool isChunkedMigrationSupported() override {
+        return chunkedMigrationSupported;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -102,19 +124,29 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int allowMemoryReadAccessCalled = 0;
+    int transferRangeToGpuCalled = 0;
+    int releaseCleanRangeCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
     int setCpuAllocEvictableCalled = 0;
     int allowCPUMemoryEvictionCalled = 0;
     int allowCPUMemoryEvictionImplCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
+    void *transferRangeToGpuAddress = nullptr;
+    void *releasedCleanRangeAddress = nullptr;
+    void *allowedMemoryReadAccessAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferRangeToGpuSize = 0;
+    size_t releasedCleanRangeSize = 0;
+    size_t readAccessAllowedSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
     bool isCpuAllocEvictable = true;
+    bool chunkedMigrationSupported = true;
     aub_stream::EngineType engineType = aub_stream::EngineType::NUM_ENGINES;
     EngineUsage engineUsage = EngineUsage::engineUsageCount;
 };
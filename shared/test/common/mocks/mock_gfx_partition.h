@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/memory_manager/gfx_partition.h"
+#include "shared/source/utilities/heap_allocator.h"
 
 using namespace NEO;
 
@@ -67,11 +68,20 @@ class MockGfxPartition : public GfxPartition {
             GfxPartition::freeGpuAddressRange(gpuAddress, size);
         }
     }
+    void freeGpuAddressRanges(std::vector<HeapChunk> &ranges) override {
+        freeGpuAddressRangesCalled++;
+        for (auto &range : ranges) {
+            freeGpuAddressRange(range.ptr, range.size);
+        }
+        ranges.clear();
+    }
+
     void initHeap(HeapIndex heapIndex, uint64_t base, uint64_t size, size_t allocationAlignment) {
         getHeap(heapIndex).init(base, size, allocationAlignment);
     }
 
     uint32_t freeGpuAddressRangeCalled = 0u;
+    uint32_t freeGpuAddressRangesCalled = 0u;
     bool callBasefreeGpuAddressRange = false;
 
     static std::array<HeapIndex, static_cast<uint32_t>(HeapIndex::totalHeaps)> allHeapNames;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@ extern FILE *mockFopenReturned;
 extern uint32_t mockVfptrinfCalled;
 extern uint32_t mockFcloseCalled;
 extern uint32_t mockGetenvCalled;
+extern uint32_t mockGetEnvironmentCalled;
 extern uint32_t mockFseekCalled;
 extern uint32_t mockFtellCalled;
 extern long int mockFtellReturn;
@@ -68,6 +69,9 @@ inline char *mockGetenv(const char *name) noexcept {
     return nullptr;
 }
 
+// environment built from mockableEnvValues, valid until next call
+char **mockGetEnvironment();
+
 inline int mockFseek(FILE *stream, long int offset, int origin) {
     mockFseekCalled++;
     return 0;
@@ -1,13 +1,15 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/aub/aub_helper.h"
 #include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/command_stream/aub_command_stream_receiver_hw.h"
 #include "shared/source/helpers/address_patch.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/flat_batch_buffer_helper.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/helpers/neo_driver_version.h"
@@ -31,7 +33,9 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <memory>
 
 using namespace NEO;
@@ -230,6 +234,157 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenWriteMemoryIsCalle
     EXPECT_TRUE(mockAubFileStream->lockStreamCalled);
 }
 
+HWTEST_F(AubFileStreamTests, givenAubDumpSkipUnchangedPagesWhenWritingGpuReadOnlyAllocationAgainThenOnlyChangedPagesAreDumped) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(pDevice->commandStreamReceivers[0]->getOsContext());
+    aubCsr->aubManager = nullptr;
+    aubCsr->hardwareContextController.reset(nullptr);
+    aubCsr->stream = mockAubFileStream.get();
+    aubCsr->initializeEngine();
+
+    constexpr size_t numPages = 4;
+    constexpr size_t size = numPages * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0, size);
+    uint64_t gpuAddress = 0x100000;
+
+    MockGraphicsAllocation commandBuffer(memory, gpuAddress, size);
+    commandBuffer.allocationType = AllocationType::commandBuffer;
+
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(commandBuffer);
+    EXPECT_EQ(size, mockAubFileStream->writtenMemorySize);
+
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(commandBuffer);
+    EXPECT_EQ(0u, mockAubFileStream->writtenMemorySize);
+
+    memset(ptrOffset(memory, 2 * MemoryConstants::pageSize), 1, 8);
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(commandBuffer);
+    EXPECT_EQ(MemoryConstants::pageSize, mockAubFileStream->writtenMemorySize);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubFileStreamTests, givenAubDumpSkipUnchangedPagesWhenWritingGpuWritableMemoryThenAllPagesAreDumpedAndSkippedPagesAreForgotten) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(pDevice->commandStreamReceivers[0]->getOsContext());
+    aubCsr->aubManager = nullptr;
+    aubCsr->hardwareContextController.reset(nullptr);
+    aubCsr->stream = mockAubFileStream.get();
+    aubCsr->initializeEngine();
+
+    constexpr size_t numPages = 4;
+    constexpr size_t size = numPages * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0, size);
+    uint64_t gpuAddress = 0x100000;
+
+    MockGraphicsAllocation commandBuffer(memory, gpuAddress, size);
+    commandBuffer.allocationType = AllocationType::commandBuffer;
+
+    MockGraphicsAllocation buffer(memory, gpuAddress, size);
+    EXPECT_FALSE(AubHelper::isGpuReadOnlyAllocationType(buffer.getAllocationType()));
+
+    aubCsr->writeMemory(commandBuffer);
+
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(buffer);
+    EXPECT_EQ(size, mockAubFileStream->writtenMemorySize);
+
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(buffer);
+    EXPECT_EQ(size, mockAubFileStream->writtenMemorySize);
+
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(commandBuffer);
+    EXPECT_EQ(size, mockAubFileStream->writtenMemorySize);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubFileStreamTests, givenAubDumpSkipUnchangedPagesDisabledWhenWritingMemoryAgainThenAllPagesAreDumped) {
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(pDevice->commandStreamReceivers[0]->getOsContext());
+    aubCsr->aubManager = nullptr;
+    aubCsr->hardwareContextController.reset(nullptr);
+    aubCsr->stream = mockAubFileStream.get();
+    aubCsr->initializeEngine();
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0, size);
+    uint64_t gpuAddress = 0x100000;
+
+    aubCsr->writeMemory(gpuAddress, memory, size, MemoryBanks::mainBank, PageTableEntry::presentBit);
+    mockAubFileStream->writtenMemorySize = 0u;
+    aubCsr->writeMemory(gpuAddress, memory, size, MemoryBanks::mainBank, PageTableEntry::presentBit);
+    EXPECT_EQ(size, mockAubFileStream->writtenMemorySize);
+
+    alignedFree(memory);
+}
+
+TEST(AubFileStreamAsyncWriterTests, givenAubDumpAsyncFileWriterWhenWritingToAubFileStreamThenDataIsInFileAfterClose) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.AUBDumpAsyncFileWriter.set(true);
+
+    std::string fileName = "async_file_writer.aub";
+    std::string expected = "async file writer data";
+    {
+        AubMemDump::AubFileStream aubFileStream;
+        aubFileStream.open(fileName.c_str());
+        ASSERT_TRUE(aubFileStream.isOpen());
+        EXPECT_NE(nullptr, aubFileStream.asyncWriter.get());
+
+        aubFileStream.write(expected.c_str(), expected.size());
+        aubFileStream.flush();
+        aubFileStream.close();
+        EXPECT_EQ(nullptr, aubFileStream.asyncWriter.get());
+    }
+
+    std::ifstream file(fileName, std::ifstream::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(expected, content);
+}
+
+TEST(AubFileStreamAsyncWriterTests, givenAubDumpAsyncFileWriterWhenAubFileStreamIsFlushedThenDataIsInFileBeforeClose) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.AUBDumpAsyncFileWriter.set(true);
+
+    std::string fileName = "async_file_writer_flush.aub";
+    std::string expected = "async file writer data";
+
+    AubMemDump::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    ASSERT_TRUE(aubFileStream.isOpen());
+    ASSERT_NE(nullptr, aubFileStream.asyncWriter.get());
+
+    aubFileStream.write(expected.c_str(), expected.size());
+    aubFileStream.flush();
+
+    std::ifstream file(fileName, std::ifstream::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(expected, content);
+}
+
 HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenPollForCompletionIsCalledThenFileStreamShouldBeLocked) {
     auto mockAubFileStream = std::make_unique<MockAubFileStream>();
     auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
@@ -8,6 +8,7 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/debug_env_reader.h"
 #include "shared/source/utilities/debug_file_reader.h"
 #include "shared/source/utilities/logger.h"
 #include "shared/test/common/debug_settings/debug_settings_manager_fixture.h"
@@ -21,6 +22,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 extern ApiSpecificConfig::ApiType apiTypeForUlts;
@@ -381,6 +383,25 @@ TEST(DebugSettingsManager, givenEnabledDebugManagerWhenCreateThenAllVariablesAre
     }
 }
 
+TEST(DebugSettingsManager, givenEnvironmentReaderWhenInjectingSettingsThenEnvironmentIsScannedOnceInsteadOfGetenvPerVariable) {
+    FullyEnabledTestDebugManager debugManager;
+    debugManager.setReaderImpl(new EnvironmentVariableReader);
+
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+    std::unordered_map<std::string, std::string> mockableEnvs = {{"LogApiCalls", "1"},
+                                                                 {"NEO_MakeAllBuffersResident", "1"}};
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&IoFunctions::mockableEnvValues, &mockableEnvs);
+
+    debugManager.injectSettingsFromReader();
+
+    EXPECT_EQ(1, debugManager.flags.LogApiCalls.get());
+    EXPECT_EQ(1, debugManager.flags.MakeAllBuffersResident.get());
+    EXPECT_EQ(DebugVarPrefix::neo, debugManager.flags.MakeAllBuffersResident.getPrefixType());
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+}
+
 TEST(DebugSettingsManager, GivenLogsEnabledAndDumpToFileWhenPrintDebuggerLogCalledThenStringPrintedToFile) {
     if (!NEO::fileLoggerInstance().enabled()) {
         GTEST_SKIP();
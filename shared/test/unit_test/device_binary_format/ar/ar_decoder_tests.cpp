@@ -1,13 +1,16 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <map>
+
 using namespace NEO::Ar;
 
 TEST(ArDecoderIsAr, WhenNotArThenReturnsFalse) {
@@ -424,3 +427,46 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderDecodeAr, GivenDeduplicatedFileEntriesThenAliasesAreResolvedToDataOfAliasedEntries) {
+    const uint8_t data0[] = "23571113171923293137414347535961";
+    const uint8_t data1[] = "67717379838997101103107109113127";
+    ArEncoder encoder(true);
+    encoder.appendDeduplicatedFileEntry("a", data0);
+    encoder.appendDeduplicatedFileEntry("b", data1);
+    encoder.appendDeduplicatedFileEntry("c", data0);
+    encoder.appendDeduplicatedFileEntry("d", data1);
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_NE(nullptr, ar.magic);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+
+    std::map<std::string, ArrayRef<const uint8_t>> files;
+    for (auto &file : ar.files) {
+        files[file.fileName.str()] = file.fileData;
+    }
+    ASSERT_EQ(1U, files.count("c"));
+    ASSERT_EQ(1U, files.count("d"));
+    EXPECT_EQ(files["a"].begin(), files["c"].begin());
+    EXPECT_EQ(files["a"].size(), files["c"].size());
+    EXPECT_EQ(files["b"].begin(), files["d"].begin());
+    EXPECT_EQ(files["b"].size(), files["d"].size());
+}
+
+TEST(ArDecoderDecodeAr, GivenAliasToUnknownFileEntryThenDecodingFails) {
+    std::string aliasData = arFileEntryAliasMagic.str() + "unknown";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", ArrayRef<const uint8_t>::fromAny(aliasData.data(), aliasData.size()));
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_EQ(nullptr, ar.magic);
+    EXPECT_EQ(0U, ar.files.size());
+    EXPECT_STREQ("Corrupt AR archive - alias file entry with identifier 'a' refers to unknown file entry 'unknown'", decodeErrors.c_str());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/test/common/test_macros/test.h"
@@ -147,3 +148,42 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenFilesWithIdenticalDataWhenAppendingDeduplicatedFileEntriesThenDataIsStoredOnceAndDuplicatesAreAliases) {
+    const uint8_t data0[] = "23571113171923293137414347535961";
+    const uint8_t data1[] = "67717379838997101103107109113127";
+    ArEncoder encoder;
+    ASSERT_NE(nullptr, encoder.appendDeduplicatedFileEntry("a", data0));
+    ASSERT_NE(nullptr, encoder.appendDeduplicatedFileEntry("b", data1));
+    auto aliasHeader = encoder.appendDeduplicatedFileEntry("c", data0);
+    ASSERT_NE(nullptr, aliasHeader);
+
+    std::string expectedAliasData = arFileEntryAliasMagic.str() + "a";
+    auto expectedAliasSize = std::to_string(expectedAliasData.size());
+    EXPECT_EQ(expectedAliasSize, std::string(aliasHeader->fileSizeInBytes, expectedAliasSize.size()));
+    auto aliasData = reinterpret_cast<const char *>(aliasHeader + 1);
+    EXPECT_EQ(0, memcmp(aliasData, expectedAliasData.data(), expectedAliasData.size()));
+
+    auto arData = encoder.encode();
+    EXPECT_EQ(arMagic.size() + 3 * sizeof(ArFileEntryHeader) + alignUp(sizeof(data0), 2) + alignUp(sizeof(data1), 2) + alignUp(expectedAliasData.size(), 2), arData.size());
+}
+
+TEST(ArEncoder, GivenDataSmallerThanAliasWhenAppendingDeduplicatedFileEntryThenDataIsCopied) {
+    const uint8_t data[] = "2357";
+    ArEncoder encoder;
+    ASSERT_NE(nullptr, encoder.appendDeduplicatedFileEntry("a", data));
+    auto header = encoder.appendDeduplicatedFileEntry("b", data);
+    ASSERT_NE(nullptr, header);
+    EXPECT_EQ(0, memcmp(header + 1, data, sizeof(data)));
+}
+
+TEST(ArEncoder, GivenAliasedFileNameReusedByAnotherEntryWhenAppendingDeduplicatedFileEntryThenDataIsCopied) {
+    const uint8_t data0[] = "23571113171923293137414347535961";
+    const uint8_t data1[] = "67717379838997101103107109113127";
+    ArEncoder encoder;
+    ASSERT_NE(nullptr, encoder.appendDeduplicatedFileEntry("a", data0));
+    ASSERT_NE(nullptr, encoder.appendDeduplicatedFileEntry("a", data1));
+    auto header = encoder.appendDeduplicatedFileEntry("b", data0);
+    ASSERT_NE(nullptr, header);
+    EXPECT_EQ(0, memcmp(header + 1, data0, sizeof(data0)));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,8 @@
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/common/test_macros/test_base.h"
 
+#include <algorithm>
+
 TEST(IsDeviceBinaryFormatAr, GivenValidBinaryThenReturnTrue) {
     auto emptyArchive = ArrayRef<const uint8_t>::fromAny(NEO::Ar::arMagic.begin(), NEO::Ar::arMagic.size());
     EXPECT_TRUE(NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::archive>(emptyArchive));
@@ -131,6 +133,49 @@ TEST(UnpackSingleDeviceBinaryAr, WhenBinaryWithProductConfigIsFoundThenPackedTar
     EXPECT_NE(0U, unpacked.packedTargetDeviceBinary.size());
 }
 
+TEST(UnpackSingleDeviceBinaryAr, WhenMatchedBinaryIsAliasOfDeduplicatedBinaryThenAliasedBinaryIsUsedWithoutCopy) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    NEO::Ar::ArEncoder encoder(true);
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    ASSERT_TRUE(encoder.appendDeduplicatedFileEntry(requiredPointerSize + ".unk", programTokens.storage));
+    ASSERT_TRUE(encoder.appendDeduplicatedFileEntry(requiredPointerSize + "." + requiredProductConfig, programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    EXPECT_GT(2 * programTokens.storage.size(), arData.size());
+
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    EXPECT_EQ(NEO::DeviceBinaryFormat::patchtokens, unpacked.format);
+
+    unpackErrors.clear();
+    unpackWarnings.clear();
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    ASSERT_NE(nullptr, decodedAr.magic);
+    auto aliasedBinary = std::find_if(decodedAr.files.begin(), decodedAr.files.end(), [&](const auto &file) { return file.fileName.str() == requiredPointerSize + ".unk"; });
+    ASSERT_NE(decodedAr.files.end(), aliasedBinary);
+    EXPECT_EQ(aliasedBinary->fileData.begin(), unpacked.deviceBinary.begin());
+    EXPECT_EQ(aliasedBinary->fileData.begin(), unpacked.packedTargetDeviceBinary.begin());
+    EXPECT_EQ(programTokens.storage.size(), unpacked.packedTargetDeviceBinary.size());
+}
+
 TEST(UnpackSingleDeviceBinaryAr, WhenMultipleBinariesMatchedThenChooseBestMatch) {
     PatchTokensTestData::ValidEmptyProgram programTokens;
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
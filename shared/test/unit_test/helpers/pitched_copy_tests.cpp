@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/pitched_copy.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+struct PitchedCopyParams {
+    size_t rowSize;
+    size_t rowCount;
+    size_t sliceCount;
+    size_t srcRowPitch;
+    size_t srcSlicePitch;
+    size_t dstRowPitch;
+    size_t dstSlicePitch;
+};
+
+namespace {
+void copyPitchedRegionPerRow(void *dst, const void *src, const PitchedCopyParams &params) {
+    for (size_t slice = 0; slice < params.sliceCount; slice++) {
+        for (size_t row = 0; row < params.rowCount; row++) {
+            memcpy_s(ptrOffset(dst, params.dstSlicePitch * slice + params.dstRowPitch * row), params.rowSize,
+                     ptrOffset(src, params.srcSlicePitch * slice + params.srcRowPitch * row), params.rowSize);
+        }
+    }
+}
+} // namespace
+
+class PitchedCopyTest : public ::testing::TestWithParam<PitchedCopyParams> {};
+
+TEST_P(PitchedCopyTest, givenPitchedRegionWhenCopyPitchedRegionIsCalledThenResultMatchesPerRowCopy) {
+    const auto &params = GetParam();
+
+    size_t srcSize = params.srcSlicePitch * params.sliceCount + params.srcRowPitch * params.rowCount + params.rowSize;
+    size_t dstSize = params.dstSlicePitch * params.sliceCount + params.dstRowPitch * params.rowCount + params.rowSize;
+
+    std::vector<uint8_t> src(srcSize);
+    for (size_t i = 0; i < srcSize; i++) {
+        src[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    std::vector<uint8_t> expected(dstSize, 0xCD);
+    std::vector<uint8_t> actual(dstSize, 0xCD);
+
+    copyPitchedRegionPerRow(expected.data(), src.data(), params);
+    copyPitchedRegion(actual.data(), params.dstRowPitch, params.dstSlicePitch,
+                      src.data(), params.srcRowPitch, params.srcSlicePitch,
+                      params.rowSize, params.rowCount, params.sliceCount);
+
+    EXPECT_EQ(expected, actual);
+}
+
+PitchedCopyParams pitchedCopyParams[] = {
+    {16, 1, 1, 16, 16, 16, 16},
+    {16, 4, 1, 16, 64, 16, 64},
+    {16, 4, 3, 16, 64, 16, 64},
+    {16, 4, 3, 16, 80, 16, 96},
+    {16, 4, 3, 32, 128, 16, 64},
+    {16, 4, 3, 16, 64, 48, 192},
+    {12, 5, 2, 20, 100, 28, 140},
+    {8, 1, 4, 64, 8, 128, 8},
+    {4, 3, 2, 4, 0x20, 4, 0x40}};
+
+INSTANTIATE_TEST_CASE_P(PitchedCopy,
+                        PitchedCopyTest,
+                        ::testing::ValuesIn(pitchedCopyParams));
+
+TEST(PitchedCopy, givenEmptyRegionWhenCopyPitchedRegionIsCalledThenNothingIsCopied) {
+    uint8_t src[16] = {1};
+    uint8_t dst[16] = {};
+
+    copyPitchedRegion(dst, 16, 16, src, 16, 16, 0, 1, 1);
+    copyPitchedRegion(dst, 16, 16, src, 16, 16, 16, 0, 1);
+    copyPitchedRegion(dst, 16, 16, src, 16, 16, 16, 1, 0);
+
+    EXPECT_EQ(0u, dst[0]);
+}
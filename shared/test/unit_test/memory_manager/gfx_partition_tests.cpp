@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
@@ -929,4 +930,37 @@ TEST(GfxPartitionTest, givenHeapIndexWhenCheckingIsAnyHeap32ThenTrueIsReturnedFo
     for (size_t i = 0; i < sizeof(heapsOther) / sizeof(heapsOther[0]); i++) {
         EXPECT_FALSE(GfxPartition::isAnyHeap32(heapsOther[i]));
     }
-}
\ No newline at end of file
+}
+
+TEST(GfxPartitionTest, givenAdjacentRangesFromDifferentHeapsWhenFreeingGpuAddressRangesThenRangesAreReturnedToTheirHeaps) {
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    constexpr size_t rangesCount = 3u;
+    std::vector<HeapChunk> ranges;
+    for (size_t i = 0; i < rangesCount; i++) {
+        size_t size = MemoryConstants::pageSize64k;
+        auto ptr = gfxPartition.heapAllocate(HeapIndex::heapStandard, size);
+        ASSERT_NE(0u, ptr);
+        ranges.emplace_back(ptr, size);
+    }
+    size_t otherHeapSize = MemoryConstants::pageSize64k;
+    auto otherHeapPtr = gfxPartition.heapAllocate(HeapIndex::heapStandard64KB, otherHeapSize);
+    ASSERT_NE(0u, otherHeapPtr);
+    ranges.emplace_back(otherHeapPtr, otherHeapSize);
+
+    uint64_t lowestPtr = std::min({ranges[0].ptr, ranges[1].ptr, ranges[2].ptr});
+    EXPECT_EQ(lowestPtr + (rangesCount - 1) * MemoryConstants::pageSize64k, std::max({ranges[0].ptr, ranges[1].ptr, ranges[2].ptr}));
+
+    gfxPartition.GfxPartition::freeGpuAddressRanges(ranges);
+    EXPECT_TRUE(ranges.empty());
+
+    size_t mergedSize = rangesCount * MemoryConstants::pageSize64k;
+    EXPECT_EQ(lowestPtr, gfxPartition.heapAllocate(HeapIndex::heapStandard, mergedSize));
+    EXPECT_EQ(rangesCount * MemoryConstants::pageSize64k, mergedSize);
+    size_t otherHeapSizeAgain = MemoryConstants::pageSize64k;
+    EXPECT_EQ(otherHeapPtr, gfxPartition.heapAllocate(HeapIndex::heapStandard64KB, otherHeapSizeAgain));
+
+    gfxPartition.heapFree(HeapIndex::heapStandard, lowestPtr, mergedSize);
+    gfxPartition.heapFree(HeapIndex::heapStandard64KB, otherHeapPtr, otherHeapSizeAgain);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1074,6 +1074,75 @@ TEST_F(HostPtrAllocationTest, GivenAllocationsWithBiggerOverlapWhenChckingForOve
     EXPECT_EQ(RequirementsStatus::success, status);
 }
 
+TEST_F(HostPtrAllocationTest, givenUnusedFragmentsCacheWhenAllocationIsFreedThenFragmentStaysPinnedAndIsReusedForSubRange) {
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+    hostPtrManager->setUnusedFragmentsCacheSize(16 * MemoryConstants::pageSize);
+
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 4 * MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCacheMisses());
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+
+    graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, ptrOffset(cpuPtr, MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCacheHits());
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCacheMisses());
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+
+    hostPtrManager->releaseUnusedFragments(*memoryManager);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
+TEST_F(HostPtrAllocationTest, givenUnusedFragmentsOverCacheSizeWhenAllocationsAreFreedThenLeastRecentlyUsedFragmentsAreReleased) {
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+    hostPtrManager->setUnusedFragmentsCacheSize(2 * MemoryConstants::pageSize);
+
+    void *cpuPtrs[] = {reinterpret_cast<void *>(0x100000), reinterpret_cast<void *>(0x200000), reinterpret_cast<void *>(0x300000)};
+    GraphicsAllocation *graphicsAllocations[3] = {};
+    for (uint32_t i = 0; i < 3; i++) {
+        graphicsAllocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtrs[i]);
+        ASSERT_NE(nullptr, graphicsAllocations[i]);
+    }
+    for (uint32_t i = 0; i < 3; i++) {
+        memoryManager->freeGraphicsMemory(graphicsAllocations[i]);
+    }
+
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(nullptr, hostPtrManager->getFragment({cpuPtrs[0], csr->getRootDeviceIndex()}));
+    EXPECT_NE(nullptr, hostPtrManager->getFragment({cpuPtrs[1], csr->getRootDeviceIndex()}));
+    EXPECT_NE(nullptr, hostPtrManager->getFragment({cpuPtrs[2], csr->getRootDeviceIndex()}));
+
+    hostPtrManager->releaseUnusedFragments(*memoryManager);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
+TEST_F(HostPtrAllocationTest, givenUnusedFragmentWhenBiggerOverlappingAllocationIsRequestedThenUnusedFragmentIsReleasedAndAllocationSucceeds) {
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+    hostPtrManager->setUnusedFragmentsCacheSize(16 * MemoryConstants::pageSize);
+
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+
+    graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 4 * MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    auto fragment = hostPtrManager->getFragment({cpuPtr, csr->getRootDeviceIndex()});
+    ASSERT_NE(nullptr, fragment);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, fragment->fragmentSize);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    hostPtrManager->releaseUnusedFragments(*memoryManager);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
 TEST(HostPtrEntryKeyTest, givenTwoHostPtrEntryKeysWhenComparingThemThenKeyWithLowerRootDeviceIndexIsLower) {
 
     auto hostPtr0 = reinterpret_cast<void *>(0x100);
@@ -1,15 +1,17 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/memory_manager/mock_prefetch_manager.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_svm_manager.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 
@@ -86,3 +88,227 @@ TEST(PrefetchManagerTests, givenPrefetchManagerWhenCallingMigrateAllocationsToGp
     EXPECT_TRUE(prefetchManager->migrateAllocationsToGpuCalled);
     EXPECT_FALSE(svmManager->prefetchMemoryCalled);
 }
+
+TEST(PrefetchManagerTests, givenSharedAllocationWhenPrefetchingAsyncThenWorkerPrefetchesItAndMigrateAllocationsToGpuSkipsItOnce) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_EQ(nullptr, prefetchManager->prefetchThread.get());
+
+    prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, ptr, *svmData, *svmManager, *device, *csr);
+    EXPECT_NE(nullptr, prefetchManager->prefetchThread.get());
+    EXPECT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(1u, prefetchContext.asyncPrefetchedAllocations.size());
+    EXPECT_EQ(1u, prefetchContext.lastAsyncRequestId);
+
+    prefetchManager->waitForAsyncPrefetches(prefetchContext.lastAsyncRequestId);
+    EXPECT_EQ(1u, prefetchManager->completedRequestsCount);
+    EXPECT_EQ(1u, prefetchManager->prefetchBatchCalled);
+    EXPECT_TRUE(svmManager->prefetchMemoryCalled);
+
+    svmManager->prefetchMemoryCalled = false;
+    prefetchManager->migrateAllocationsToGpu(prefetchContext, *svmManager, *device, *csr);
+    EXPECT_FALSE(svmManager->prefetchMemoryCalled);
+    EXPECT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(0u, prefetchContext.asyncPrefetchedAllocations.size());
+
+    prefetchManager->migrateAllocationsToGpu(prefetchContext, *svmManager, *device, *csr);
+    EXPECT_TRUE(svmManager->prefetchMemoryCalled);
+
+    prefetchManager->removeAllocations(prefetchContext);
+    EXPECT_EQ(0u, prefetchContext.allocations.size());
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenAsyncPrefetchesInFlightWhenRemovingAllocationsThenAllRequestsAreCompletedFirst) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    std::vector<void *> ptrs;
+    for (auto i = 0u; i < 4u; i++) {
+        auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+        ASSERT_NE(nullptr, ptr);
+        prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, ptr, *svmManager->getSVMAlloc(ptr), *svmManager, *device, *csr);
+        ptrs.push_back(ptr);
+    }
+    EXPECT_EQ(4u, prefetchContext.lastAsyncRequestId);
+
+    prefetchManager->removeAllocations(prefetchContext);
+    EXPECT_EQ(4u, prefetchManager->completedRequestsCount);
+    EXPECT_LE(1u, prefetchManager->prefetchBatchCalled);
+    EXPECT_GE(4u, prefetchManager->prefetchBatchCalled);
+    EXPECT_EQ(0u, prefetchContext.allocations.size());
+    EXPECT_EQ(0u, prefetchContext.asyncPrefetchedAllocations.size());
+
+    for (auto ptr : ptrs) {
+        svmManager->freeSVMAlloc(ptr);
+    }
+}
+
+TEST(PrefetchManagerTests, givenNonSharedAllocationWhenPrefetchingAsyncThenRequestIsNotQueued) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createUnifiedMemoryAllocation(4096u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+
+    prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, ptr, *svmManager->getSVMAlloc(ptr), *svmManager, *device, *csr);
+    EXPECT_EQ(nullptr, prefetchManager->prefetchThread.get());
+    EXPECT_EQ(0u, prefetchManager->queuedRequestsCount);
+    EXPECT_EQ(0u, prefetchContext.allocations.size());
+
+    prefetchManager->waitForAllAsyncPrefetches();
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenAsyncPrefetchInFlightWhenWaitingForPrefetchesOfOtherAllocationThenDoNotWaitForThatPrefetch) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto otherPtr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, otherPtr);
+
+    prefetchManager->blockPrefetchBatch = true;
+    prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, ptr, *svmManager->getSVMAlloc(ptr), *svmManager, *device, *csr);
+    while (!prefetchManager->prefetchBatchEntered) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(1u, prefetchManager->pendingRequestIds.size());
+
+    prefetchManager->waitForAllocationPrefetches(*svmManager->getSVMAlloc(otherPtr));
+    EXPECT_EQ(0u, prefetchManager->completedRequestsCount);
+
+    prefetchManager->blockPrefetchBatch = false;
+    prefetchManager->waitForAllocationPrefetches(*svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(1u, prefetchManager->completedRequestsCount);
+    EXPECT_EQ(0u, prefetchManager->pendingRequestIds.size());
+
+    prefetchManager->removeAllocations(prefetchContext);
+    svmManager->freeSVMAlloc(otherPtr);
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenAsyncPrefetchInFlightWhenMigratingAllocationsToGpuThenPrefetchContextIsNotLockedWhileWaiting) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto otherPtr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, otherPtr);
+
+    prefetchManager->blockPrefetchBatch = true;
+    prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, ptr, *svmManager->getSVMAlloc(ptr), *svmManager, *device, *csr);
+    while (!prefetchManager->prefetchBatchEntered) {
+        std::this_thread::yield();
+    }
+
+    std::thread migrateThread([&]() {
+        prefetchManager->migrateAllocationsToGpu(prefetchContext, *svmManager, *device, *csr);
+    });
+
+    prefetchManager->insertAllocation(prefetchContext, otherPtr, *svmManager->getSVMAlloc(otherPtr));
+
+    prefetchManager->blockPrefetchBatch = false;
+    migrateThread.join();
+
+    EXPECT_EQ(1u, prefetchManager->completedRequestsCount);
+    EXPECT_EQ(2u, prefetchContext.allocations.size());
+    EXPECT_EQ(0u, prefetchContext.asyncPrefetchedAllocations.size());
+
+    prefetchManager->removeAllocations(prefetchContext);
+    svmManager->freeSVMAlloc(otherPtr);
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenAsyncPrefetchOfInteriorPointerInFlightWhenFreeingAllocationThenFreeWaitsForThatPrefetch) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+    auto prefetchManager = static_cast<MockPrefetchManager *>(memoryManager->prefetchManager.get());
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto interiorPtr = ptrOffset(ptr, 64u);
+
+    prefetchManager->blockPrefetchBatch = true;
+    prefetchManager->insertAllocationAndPrefetchAsync(prefetchContext, interiorPtr, *svmManager->getSVMAlloc(interiorPtr), *svmManager, *device, *csr);
+    while (!prefetchManager->prefetchBatchEntered) {
+        std::this_thread::yield();
+    }
+
+    std::atomic_bool freed = false;
+    std::thread freeThread([&]() {
+        svmManager->freeSVMAlloc(ptr);
+        freed = true;
+    });
+
+    for (auto i = 0u; i < 1000u; i++) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(freed);
+
+    prefetchManager->blockPrefetchBatch = false;
+    freeThread.join();
+
+    EXPECT_TRUE(freed);
+    EXPECT_EQ(1u, prefetchManager->completedRequestsCount);
+    EXPECT_EQ(1u, prefetchManager->prefetchBatchCalled);
+
+    prefetchManager->removeAllocations(prefetchContext);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -483,6 +483,39 @@ TEST_F(DebugEnvReaderTests, GivenBoolEnvVariableWhenGettingThenCorrectValueIsRet
     }
 }
 
+TEST_F(DebugEnvReaderTests, givenBatchReadWhenGettingSettingsThenEnvironmentIsScannedOnceAndGetenvIsNotCalled) {
+    VariableBackup<ApiSpecificConfig::ApiType> backup(&apiTypeForUlts, ApiSpecificConfig::OCL);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+    std::unordered_map<std::string, std::string> mockableEnvs = {{"TestingVariable", "1"},
+                                                                 {"NEO_OCL_TestingVariable", "1234"},
+                                                                 {"NEO_StringVariable", "Expected Value"},
+                                                                 {"UnprefixedVariable", "5"}};
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&IoFunctions::mockableEnvValues, &mockableEnvs);
+
+    environmentVariableReader->beginBatchRead();
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+
+    DebugVarPrefix type = DebugVarPrefix::none;
+    EXPECT_EQ(1234, environmentVariableReader->getSetting("TestingVariable", 0, type));
+    EXPECT_EQ(DebugVarPrefix::neoOcl, type);
+
+    EXPECT_EQ("Expected Value", environmentVariableReader->getSetting("StringVariable", std::string("Default Value"), type));
+    EXPECT_EQ(DebugVarPrefix::neo, type);
+
+    EXPECT_EQ("Default Value", environmentVariableReader->getSetting("MissingVariable", std::string("Default Value"), type));
+    EXPECT_EQ(DebugVarPrefix::none, type);
+
+    EXPECT_EQ(5, environmentVariableReader->getSetting("UnprefixedVariable", 0));
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+
+    environmentVariableReader->endBatchRead();
+    mockableEnvs["UnprefixedVariable"] = "6";
+    EXPECT_EQ(6, environmentVariableReader->getSetting("UnprefixedVariable", 0));
+    EXPECT_EQ(1u, IoFunctions::mockGetenvCalled);
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+}
+
 TEST_F(DebugEnvReaderTests, WhenSettingAppSpecificLocationThenLocationIsReturned) {
     std::string appSpecific;
     appSpecific = "cl_cache_dir";
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -175,6 +175,31 @@ TEST_F(DeviceFactoryTests, givenMultipleDevicesWhenInitializeResourcesFailsForAl
     EXPECT_EQ(0u, executionEnvironment.rootDeviceEnvironments.size());
 }
 
+TEST_F(DeviceFactoryTests, givenParallelRootDeviceInitializationWhenInitializeResourcesFailsForOneDeviceThenRemainingDevicesKeepDiscoveryOrder) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CreateMultipleRootDevices.set(3);
+    debugManager.flags.ParallelRootDeviceInitialization.set(3);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), true, 3u);
+
+    auto rootDeviceEnvironment0 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[0].get());
+    auto rootDeviceEnvironment1 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[1].get());
+    auto rootDeviceEnvironment2 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[2].get());
+
+    rootDeviceEnvironment0->initOsInterfaceExpectedCallCount = 1u;
+    rootDeviceEnvironment1->initOsInterfaceResults.push_back(false);
+    rootDeviceEnvironment1->initOsInterfaceExpectedCallCount = 1u;
+    rootDeviceEnvironment2->initOsInterfaceExpectedCallCount = 1u;
+
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    ASSERT_TRUE(success);
+
+    ASSERT_EQ(2u, executionEnvironment.rootDeviceEnvironments.size());
+    EXPECT_EQ(rootDeviceEnvironment0, executionEnvironment.rootDeviceEnvironments[0].get());
+    EXPECT_EQ(rootDeviceEnvironment2, executionEnvironment.rootDeviceEnvironments[1].get());
+    EXPECT_NE(nullptr, executionEnvironment.rootDeviceEnvironments[0]->getGmmHelper());
+    EXPECT_NE(nullptr, executionEnvironment.rootDeviceEnvironments[1]->getGmmHelper());
+}
+
 TEST_F(DeviceFactoryTests, givenFailedAilInitializationResultWhenPrepareDeviceEnvironmentsIsCalledThenReturnFalse) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     auto mockRootDeviceEnvironment = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[0].get());
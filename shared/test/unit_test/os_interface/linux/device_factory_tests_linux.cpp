@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -117,6 +117,38 @@ TEST(SortAndFilterDevicesDrmTest, whenSortingAndFilteringDevicesThenMemoryOperat
     }
 }
 
+TEST(SortAndFilterDevicesDrmTest, givenParallelRootDeviceInitializationWhenPreparingDeviceEnvironmentsThenDevicesAreSortedAndMemoryOperationHandlersHaveProperIndices) {
+    static const auto numRootDevices = 8;
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.CreateMultipleRootDevices.set(numRootDevices);
+    debugManager.flags.ParallelRootDeviceInitialization.set(4);
+
+    VariableBackup<uint32_t> osContextCountBackup(&MemoryManager::maxOsContextCount);
+    VariableBackup<std::map<std::string, std::vector<std::string>>> directoryFilesMapBackup(&directoryFilesMap);
+    VariableBackup<const char *> pciDevicesDirectoryBackup(&Os::pciDevicesDirectory);
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return SysCalls::fakeFileDescriptor;
+    });
+
+    Os::pciDevicesDirectory = "/";
+    directoryFilesMap.clear();
+    directoryFilesMap[Os::pciDevicesDirectory] = {};
+    for (auto bus = numRootDevices; bus > 0; bus--) {
+        directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0000:0" + std::to_string(bus) + ":02.0-render");
+    }
+
+    ExecutionEnvironment executionEnvironment{};
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    EXPECT_TRUE(success);
+    ASSERT_EQ(static_cast<size_t>(numRootDevices), executionEnvironment.rootDeviceEnvironments.size());
+
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        auto pciBusInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface->getDriverModel()->getPciBusInfo();
+        EXPECT_EQ(rootDeviceIndex + 1, pciBusInfo.pciBus);
+        EXPECT_EQ(rootDeviceIndex, static_cast<DrmMemoryOperationsHandler &>(*executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->memoryOperationsInterface).getRootDeviceIndex());
+    }
+}
+
 TEST(DeviceFactoryAffinityMaskTest, whenAffinityMaskDoesNotSelectAnyDeviceThenEmptyEnvironmentIsReturned) {
     static const auto numRootDevices = 6;
     DebugManagerStateRestore dbgRestorer;
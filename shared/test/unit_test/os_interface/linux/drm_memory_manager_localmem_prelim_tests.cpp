@@ -1467,7 +1467,7 @@ TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenAlignmentAndSizeWhenMmapRetur
     EXPECT_EQ(alignUp(reinterpret_cast<void *>(0x12345678), MemoryConstants::pageSize64k), allocation->getMmapPtr());
     EXPECT_EQ(1u, munmapCalledCount);
     memoryManager->freeGraphicsMemory(allocation);
-    EXPECT_EQ(3u, munmapCalledCount);
+    EXPECT_EQ(2u, munmapCalledCount);
     munmapCalledCount = 0u;
 
     memoryManager->mmapFunction = SysCalls::mmap;
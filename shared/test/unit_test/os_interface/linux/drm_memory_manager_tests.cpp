@@ -3775,6 +3775,65 @@ TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerAndReleaseGpuRangeIsCalledThen
     memoryManager->overrideGfxPartition(mockGfxPartitionBasic.release());
 }
 
+TEST_F(DrmMemoryManagerTest, givenBatchedGpuRangeReleaseWhenReleasingGpuRangesThenRangesAreFreedInOnePassAtEndOfOutermostBatch) {
+    constexpr size_t reservedCpuAddressRangeSize = is64bit ? (6 * 4 * MemoryConstants::gigaByte) : 0;
+    auto hwInfo = defaultHwInfo.get();
+    auto mockGfxPartition = std::make_unique<MockGfxPartition>();
+    mockGfxPartition->init(hwInfo->capabilityTable.gpuAddressSpace, reservedCpuAddressRangeSize, 0, 1, false, 0u);
+    auto gfxPartition = mockGfxPartition.get();
+    memoryManager->overrideGfxPartition(mockGfxPartition.release());
+
+    auto gmmHelper = device->getGmmHelper();
+    size_t size = MemoryConstants::pageSize64k;
+    auto gpuAddress0 = gmmHelper->canonize(gfxPartition->heapAllocate(HeapIndex::heapStandard, size));
+    auto gpuAddress1 = gmmHelper->canonize(gfxPartition->heapAllocate(HeapIndex::heapStandard, size));
+
+    memoryManager->startBatchedGpuRangeRelease();
+    memoryManager->startBatchedGpuRangeRelease();
+    memoryManager->releaseGpuRange(reinterpret_cast<void *>(gpuAddress0), size, 0);
+    memoryManager->releaseGpuRange(reinterpret_cast<void *>(gpuAddress1), size, 0);
+    EXPECT_EQ(0u, gfxPartition->freeGpuAddressRangeCalled);
+
+    memoryManager->endBatchedGpuRangeRelease();
+    EXPECT_EQ(0u, gfxPartition->freeGpuAddressRangesCalled);
+
+    memoryManager->endBatchedGpuRangeRelease();
+    EXPECT_EQ(1u, gfxPartition->freeGpuAddressRangesCalled);
+    EXPECT_EQ(2u, gfxPartition->freeGpuAddressRangeCalled);
+
+    memoryManager->releaseGpuRange(reinterpret_cast<void *>(gpuAddress0), size, 0);
+    EXPECT_EQ(1u, gfxPartition->freeGpuAddressRangesCalled);
+    EXPECT_EQ(3u, gfxPartition->freeGpuAddressRangeCalled);
+
+    auto mockGfxPartitionBasic = std::make_unique<MockGfxPartitionBasic>();
+    memoryManager->overrideGfxPartition(mockGfxPartitionBasic.release());
+}
+
+static uint32_t mergedMunmapCalledCount = 0u;
+
+TEST(DrmAllocationMemoryToUnmapTest, givenRangeAdjacentToRegisteredMemoryToUnmapWhenMergingThenSingleUnmapCoversBothRanges) {
+    mergedMunmapCalledCount = 0u;
+    DrmAllocation::MemoryUnmapFunction unmapFunction = [](void *pointer, size_t size) throw() {
+        mergedMunmapCalledCount++;
+        EXPECT_EQ(reinterpret_cast<void *>(0x10000), pointer);
+        EXPECT_EQ(3 * MemoryConstants::pageSize, size);
+        return 0;
+    };
+    DrmAllocation::MemoryUnmapFunction otherUnmapFunction = [](void *pointer, size_t size) throw() {
+        return 0;
+    };
+    {
+        MockDrmAllocation allocation(0u, AllocationType::buffer, MemoryPool::system4KBPages);
+        allocation.registerMemoryToUnmap(reinterpret_cast<void *>(0x10000 + MemoryConstants::pageSize), MemoryConstants::pageSize, unmapFunction);
+
+        EXPECT_FALSE(allocation.mergeMemoryToUnmap(reinterpret_cast<void *>(0x10000), MemoryConstants::pageSize, otherUnmapFunction));
+        EXPECT_FALSE(allocation.mergeMemoryToUnmap(reinterpret_cast<void *>(0x20000), MemoryConstants::pageSize, unmapFunction));
+        EXPECT_TRUE(allocation.mergeMemoryToUnmap(reinterpret_cast<void *>(0x10000), MemoryConstants::pageSize, unmapFunction));
+        EXPECT_TRUE(allocation.mergeMemoryToUnmap(reinterpret_cast<void *>(0x10000 + 2 * MemoryConstants::pageSize), MemoryConstants::pageSize, unmapFunction));
+    }
+    EXPECT_EQ(1u, mergedMunmapCalledCount);
+}
+
 TEST(DrmMemoryManagerFreeGraphicsMemoryCallSequenceTest, givenDrmMemoryManagerAndFreeGraphicsMemoryIsCalledThenUnreferenceBufferObjectIsCalledFirstWithSynchronousDestroySetToTrue) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     executionEnvironment.rootDeviceEnvironments[0]->osInterface = std::make_unique<OSInterface>();
@@ -7305,6 +7364,60 @@ TEST_F(DrmMemoryManagerTest, givenMakeBosResidentSuccessWhenRegisteringMemoryAll
     EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerLocalMemAlloc(&allocation, 0));
 }
 
+TEST_F(DrmMemoryManagerTest, givenRegisteredAllocationsWhenUnregisteringAllocationThenOnlyThisAllocationIsRemoved) {
+    std::vector<std::unique_ptr<MockDrmAllocation>> allocations;
+    for (uint32_t i = 0; i < 4; i++) {
+        allocations.push_back(std::make_unique<MockDrmAllocation>(rootDeviceIndex, AllocationType::buffer, MemoryPool::system4KBPages));
+    }
+
+    auto &sysMemAllocs = memoryManager->getSysMemAllocs();
+    auto &localMemAllocs = memoryManager->getLocalMemAllocs(rootDeviceIndex);
+    auto initialSysMemAllocsCount = sysMemAllocs.size();
+    auto initialLocalMemAllocsCount = localMemAllocs.size();
+
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerSysMemAlloc(allocation.get()));
+        EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerLocalMemAlloc(allocation.get(), rootDeviceIndex));
+    }
+    EXPECT_EQ(initialSysMemAllocsCount + 4, sysMemAllocs.size());
+    EXPECT_EQ(initialLocalMemAllocsCount + 4, localMemAllocs.size());
+
+    memoryManager->unregisterAllocation(allocations[1].get());
+    EXPECT_EQ(initialSysMemAllocsCount + 3, sysMemAllocs.size());
+    EXPECT_EQ(initialLocalMemAllocsCount + 3, localMemAllocs.size());
+    EXPECT_EQ(sysMemAllocs.end(), std::find(sysMemAllocs.begin(), sysMemAllocs.end(), allocations[1].get()));
+    EXPECT_EQ(localMemAllocs.end(), std::find(localMemAllocs.begin(), localMemAllocs.end(), allocations[1].get()));
+
+    memoryManager->unregisterAllocation(allocations[1].get());
+    EXPECT_EQ(initialSysMemAllocsCount + 3, sysMemAllocs.size());
+
+    for (auto i : {0u, 2u, 3u}) {
+        EXPECT_NE(sysMemAllocs.end(), std::find(sysMemAllocs.begin(), sysMemAllocs.end(), allocations[i].get()));
+        EXPECT_NE(localMemAllocs.end(), std::find(localMemAllocs.begin(), localMemAllocs.end(), allocations[i].get()));
+    }
+
+    for (auto i : {3u, 0u, 2u}) {
+        memoryManager->unregisterAllocation(allocations[i].get());
+    }
+    EXPECT_EQ(initialSysMemAllocsCount, sysMemAllocs.size());
+    EXPECT_EQ(initialLocalMemAllocsCount, localMemAllocs.size());
+}
+
+TEST_F(DrmMemoryManagerTest, givenAllocationRegisteredTwiceWhenUnregisteringAllocationThenItIsNotTrackedAnymore) {
+    MockDrmAllocation allocation(rootDeviceIndex, AllocationType::buffer, MemoryPool::system4KBPages);
+
+    auto &sysMemAllocs = memoryManager->getSysMemAllocs();
+    auto initialSysMemAllocsCount = sysMemAllocs.size();
+
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerSysMemAlloc(&allocation));
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerSysMemAlloc(&allocation));
+    EXPECT_EQ(initialSysMemAllocsCount + 1, sysMemAllocs.size());
+
+    memoryManager->unregisterAllocation(&allocation);
+    EXPECT_EQ(initialSysMemAllocsCount, sysMemAllocs.size());
+    EXPECT_EQ(sysMemAllocs.end(), std::find(sysMemAllocs.begin(), sysMemAllocs.end(), &allocation));
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenGpuAddressReservationIsAttemptedWithKnownAddressAtIndex1ThenAddressFromGfxPartitionIsUsed) {
     auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, true, false, *executionEnvironment);
     RootDeviceIndicesContainer rootDeviceIndices;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+struct MockDrmQueryCache : public DrmQueryCache {
+    using DrmQueryCache::DrmQueryCache;
+    using DrmQueryCache::entries;
+    using DrmQueryCache::modified;
+};
+
+struct DrmQueryCacheTest : public ::testing::Test {
+    void SetUp() override {
+        std::remove(fileName.c_str());
+    }
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    static int renameFile(const char *currName, const char *dstName) {
+        return std::rename(currName, dstName);
+    }
+
+    const std::string fileName = "drm_query_cache_test.bin";
+    VariableBackup<decltype(SysCalls::sysCallsRename)> renameBackup{&SysCalls::sysCallsRename, renameFile};
+};
+
+TEST(DrmQueryCacheFilePathTest, givenPciPathWhenGettingFilePathThenSeparatorsAreReplaced) {
+    auto filePath = DrmQueryCache::getFilePath("cacheDir", "0000:00:02.0");
+    EXPECT_NE(std::string::npos, filePath.find("drm_query_cache_0000_00_02.0.bin"));
+    EXPECT_EQ(0u, filePath.find("cacheDir"));
+}
+
+TEST_F(DrmQueryCacheTest, givenStoredQueriesWhenCacheIsSavedAndLoadedWithSameKeyThenQueryResultsAreRestored) {
+    const uint64_t topology[] = {1u, 2u, 3u};
+    const uint32_t engines[] = {4u, 5u};
+    {
+        MockDrmQueryCache cache(fileName, "key");
+        EXPECT_FALSE(cache.load());
+        cache.store(1u, 0u, topology, sizeof(topology));
+        cache.store(2u, 3u, engines, sizeof(engines));
+        EXPECT_TRUE(cache.modified);
+        EXPECT_TRUE(cache.save());
+        EXPECT_FALSE(cache.modified);
+    }
+
+    MockDrmQueryCache cache(fileName, "key");
+    EXPECT_TRUE(cache.load());
+    EXPECT_EQ(2u, cache.entries.size());
+
+    auto cachedTopology = cache.get(1u, 0u);
+    ASSERT_NE(nullptr, cachedTopology);
+    ASSERT_EQ(sizeof(topology), cachedTopology->size());
+    EXPECT_EQ(0, memcmp(topology, cachedTopology->data(), sizeof(topology)));
+
+    auto cachedEngines = cache.get(2u, 3u);
+    ASSERT_NE(nullptr, cachedEngines);
+    ASSERT_EQ(sizeof(engines), cachedEngines->size());
+    EXPECT_EQ(0, memcmp(engines, cachedEngines->data(), sizeof(engines)));
+
+    EXPECT_EQ(nullptr, cache.get(2u, 0u));
+}
+
+TEST_F(DrmQueryCacheTest, givenCacheSavedWithDifferentKeyWhenLoadingThenCacheIsInvalidated) {
+    const uint64_t topology[] = {1u, 2u, 3u};
+    {
+        DrmQueryCache cache(fileName, "oldKernel");
+        cache.store(1u, 0u, topology, sizeof(topology));
+        EXPECT_TRUE(cache.save());
+    }
+
+    MockDrmQueryCache cache(fileName, "newKernel");
+    EXPECT_FALSE(cache.load());
+    EXPECT_TRUE(cache.entries.empty());
+    EXPECT_EQ(nullptr, cache.get(1u, 0u));
+}
+
+TEST_F(DrmQueryCacheTest, givenTruncatedCacheFileWhenLoadingThenCacheIsInvalidated) {
+    const uint64_t topology[] = {1u, 2u, 3u};
+    {
+        DrmQueryCache cache(fileName, "key");
+        cache.store(1u, 0u, topology, sizeof(topology));
+        EXPECT_TRUE(cache.save());
+    }
+    size_t fileSize = 0;
+    auto fileData = loadDataFromFile(fileName.c_str(), fileSize);
+    ASSERT_NE(nullptr, fileData);
+    writeDataToFile(fileName.c_str(), fileData.get(), fileSize - sizeof(uint64_t));
+
+    MockDrmQueryCache cache(fileName, "key");
+    EXPECT_FALSE(cache.load());
+    EXPECT_TRUE(cache.entries.empty());
+}
+
+TEST_F(DrmQueryCacheTest, givenFailingRenameWhenSavingCacheThenTemporaryFileIsRemovedAndCacheStaysModified) {
+    VariableBackup<decltype(SysCalls::sysCallsRename)> failingRenameBackup{&SysCalls::sysCallsRename, [](const char *, const char *) -> int { return -1; }};
+    VariableBackup<int> unlinkCalledBackup{&SysCalls::unlinkCalled, 0};
+
+    MockDrmQueryCache cache(fileName, "key");
+    const uint32_t data = 7u;
+    cache.store(1u, 0u, &data, sizeof(data));
+    EXPECT_FALSE(cache.save());
+    EXPECT_TRUE(cache.modified);
+    EXPECT_EQ(1, SysCalls::unlinkCalled);
+
+    auto tmpFileName = fileName + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+    std::remove(tmpFileName.c_str());
+}
+
+TEST_F(DrmQueryCacheTest, givenQueryCacheWhenQueryingStaticDataTwiceThenSecondResultComesFromCache) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.queryCache = std::make_unique<MockDrmQueryCache>(fileName, "key");
+
+    auto queryId = static_cast<uint32_t>(drm.getIoctlHelper()->getDrmParamValue(DrmParam::queryTopologyInfo));
+    auto queryCount = drm.ioctlCount.query.load();
+    auto liveResult = drm.query<uint64_t>(queryId, 0);
+    ASSERT_FALSE(liveResult.empty());
+    EXPECT_EQ(queryCount + 2, drm.ioctlCount.query);
+    EXPECT_NE(nullptr, drm.queryCache->get(queryId, 0));
+
+    auto cachedResult = drm.query<uint64_t>(queryId, 0);
+    EXPECT_EQ(queryCount + 2, drm.ioctlCount.query);
+    EXPECT_EQ(liveResult, cachedResult);
+}
+
+TEST_F(DrmQueryCacheTest, givenQueryCacheWhenQueryingMemoryRegionsThenResultIsNotCached) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.queryCache = std::make_unique<MockDrmQueryCache>(fileName, "key");
+
+    auto queryId = static_cast<uint32_t>(drm.getIoctlHelper()->getDrmParamValue(DrmParam::queryMemoryRegions));
+    drm.query<uint64_t>(queryId, 0);
+    EXPECT_EQ(nullptr, drm.queryCache->get(queryId, 0));
+}
+
+TEST_F(DrmQueryCacheTest, givenDifferentDeviceIdOrRevisionWhenGettingQueryCacheKeyThenKeysDiffer) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto &rootDeviceEnvironment = *executionEnvironment->rootDeviceEnvironments[0];
+    DrmMock drm{rootDeviceEnvironment};
+    auto &platform = rootDeviceEnvironment.getMutableHardwareInfo()->platform;
+
+    auto key = drm.getQueryCacheKey();
+    ASSERT_FALSE(key.empty());
+    EXPECT_EQ(key, drm.getQueryCacheKey());
+
+    platform.usRevId++;
+    auto keyWithOtherRevision = drm.getQueryCacheKey();
+    EXPECT_NE(key, keyWithOtherRevision);
+
+    platform.usDeviceID++;
+    EXPECT_NE(key, drm.getQueryCacheKey());
+    EXPECT_NE(keyWithOtherRevision, drm.getQueryCacheKey());
+}
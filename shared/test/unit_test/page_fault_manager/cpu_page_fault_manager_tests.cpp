@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -868,3 +868,185 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenUsmSharedMigrationChunkSizeSetWhenInsertingAllocationsThenChunksAreTrackedOnlyForAllocationsLargerThanChunk) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    void *largeAlloc = reinterpret_cast<void *>(0x10000);
+    void *smallAlloc = reinterpret_cast<void *>(0x100000);
+    void *cpuAlloc = reinterpret_cast<void *>(0x200000);
+    auto chunkSize = 4 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(largeAlloc, 3 * chunkSize + 1, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(smallAlloc, chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    memoryProperties.allocFlags.usmInitialPlacementCpu = 1;
+    pageFaultManager->insertAllocation(cpuAlloc, 2 * chunkSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+
+    auto &largeData = pageFaultManager->memoryData.at(largeAlloc);
+    EXPECT_EQ(chunkSize, largeData.chunkSize);
+    ASSERT_EQ(4u, largeData.chunks.size());
+    for (auto &chunk : largeData.chunks) {
+        EXPECT_EQ(MockPageFaultManager::ChunkState::none, chunk);
+    }
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(smallAlloc).chunks.size());
+
+    auto &cpuData = pageFaultManager->memoryData.at(cpuAlloc);
+    ASSERT_EQ(2u, cpuData.chunks.size());
+    for (auto &chunk : cpuData.chunks) {
+        EXPECT_EQ(MockPageFaultManager::ChunkState::cpuDirty, chunk);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedMigrationNotSupportedOrNonHwHandlerWhenInsertingAllocationThenChunksAreNotTracked) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->chunkedMigrationSupported = false;
+    pageFaultManager->insertAllocation(alloc1, MemoryConstants::pageSize64k, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(alloc1).chunks.size());
+
+    pageFaultManager->chunkedMigrationSupported = true;
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::unprotectAndTransferMemory;
+    pageFaultManager->insertAllocation(alloc2, MemoryConstants::pageSize64k, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(alloc2).chunks.size());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenVerifyingPageFaultsThenOnlyFaultingChunkIsTransferredAndMadeDirtyOnSecondFault) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    auto chunkSize = 4 * MemoryConstants::kiloByte;
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(0, pageFaultManager->transferRangeToGpuCalled);
+
+    auto &pageFaultData = pageFaultManager->memoryData.at(alloc);
+    auto chunkPtr = ptrOffset(alloc, 2 * chunkSize);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(chunkPtr, 16)));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryReadAccessCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->allowedMemoryReadAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->readAccessAllowedSize);
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::cpuClean, pageFaultData.chunks[2]);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::gpu, pageFaultData.chunks[1]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultData.domain);
+    ASSERT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(alloc, unifiedMemoryManager->nonGpuDomainAllocs[0]);
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(chunkPtr));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::cpuDirty, pageFaultData.chunks[2]);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenDirtyAndCleanChunksWhenMovingAllocationToGpuDomainThenOnlyDirtyRangesAreTransferredAndCleanRangesAreReleased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    auto chunkSize = 4 * MemoryConstants::kiloByte;
+    auto allocSize = 4 * chunkSize + 100;
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    auto &pageFaultData = pageFaultManager->memoryData.at(alloc);
+    ASSERT_EQ(5u, pageFaultData.chunks.size());
+    pageFaultData.domain = PageFaultManager::AllocationDomain::cpu;
+    pageFaultData.chunks = {MockPageFaultManager::ChunkState::cpuClean, MockPageFaultManager::ChunkState::gpu, MockPageFaultManager::ChunkState::gpu,
+                            MockPageFaultManager::ChunkState::cpuDirty, MockPageFaultManager::ChunkState::cpuDirty};
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, 3 * chunkSize), pageFaultManager->transferRangeToGpuAddress);
+    EXPECT_EQ(chunkSize + 100, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(1, pageFaultManager->releaseCleanRangeCalled);
+    EXPECT_EQ(alloc, pageFaultManager->releasedCleanRangeAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->releasedCleanRangeSize);
+    EXPECT_EQ(alloc, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultData.domain);
+    for (auto &chunk : pageFaultData.chunks) {
+        EXPECT_EQ(MockPageFaultManager::ChunkState::gpu, chunk);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationNotInGpuDomainWhenRemovingThenWholeAllocationIsMadeAccessible) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::pageSize64k, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize64k, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+}
+
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocationsWhenVerifyingPageFaultsThenAllocationContainingFaultAddressIsHandled) {
+    constexpr size_t allocationsCount = 1000;
+    constexpr size_t allocSize = 0x1000;
+    auto allocAddress = [](size_t index) { return reinterpret_cast<void *>(0x10000 + index * 2 * allocSize); };
+
+    for (size_t i = 0; i < allocationsCount; i++) {
+        pageFaultManager->insertAllocation(allocAddress(i), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+    EXPECT_EQ(allocationsCount, pageFaultManager->memoryData.size());
+
+    for (size_t i = 0; i < allocationsCount; i += 111) {
+        EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(allocAddress(i), allocSize / 2)));
+        EXPECT_EQ(allocAddress(i), pageFaultManager->allowedMemoryAccessAddress);
+        EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+
+        EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(allocAddress(i), allocSize)));
+    }
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(allocAddress(allocationsCount - 1), allocSize - 1)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x10000 - 1)));
+}
+
+TEST_F(PageFaultManagerTest, givenFaultAddressOutsideOfTrackedAllocationsWhenVerifyingPageFaultThenItIsRejectedWithoutTakingLock) {
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(alloc1));
+
+    pageFaultManager->insertAllocation(alloc2, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0x10000u, pageFaultManager->trackedRangeBegin.load());
+    EXPECT_EQ(0x20100u, pageFaultManager->trackedRangeEnd.load());
+
+    {
+        std::unique_lock<SpinLock> lock{pageFaultManager->mtx};
+        EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x1000)));
+        EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x20100)));
+    }
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    pageFaultManager->removeAllocation(alloc2);
+    EXPECT_EQ(0x10100u, pageFaultManager->trackedRangeEnd.load());
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(alloc2));
+
+    pageFaultManager->removeAllocation(alloc1);
+    EXPECT_EQ(std::numeric_limits<uintptr_t>::max(), pageFaultManager->trackedRangeBegin.load());
+    EXPECT_EQ(0u, pageFaultManager->trackedRangeEnd.load());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -119,6 +119,71 @@ TEST_F(PageFaultManagerLinuxTest, givenProtectedMemoryWithFaultHandlerRegistered
     EXPECT_EQ(ptr[0], 10);
 }
 
+class MockChunkedPageFaultManagerLinux : public PageFaultManagerLinux {
+  public:
+    using PageFaultManager::ChunkState;
+    using PageFaultManager::memoryData;
+
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        cpuTransfers.push_back({ptr, size});
+    }
+    void transferRangeToGpu(void *ptr, size_t size, void *cmdQ) override {
+        gpuTransfers.push_back({ptr, size});
+    }
+    void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) override {}
+
+    std::vector<std::pair<void *, size_t>> cpuTransfers;
+    std::vector<std::pair<void *, size_t>> gpuTransfers;
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenChunkedSharedAllocationWhenCpuReadsAndWritesProtectedChunksThenOnlyTouchedChunksAreTransferredAndOnlyWrittenChunksAreCopiedBack) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(4);
+
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+    SVMAllocsManager unifiedMemoryManager(&memoryManager, false);
+    auto pageFaultManager = std::make_unique<MockChunkedPageFaultManagerLinux>();
+
+    auto chunkSize = MemoryConstants::pageSize;
+    auto size = 4 * chunkSize;
+    auto ptr = static_cast<uint8_t *>(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+    ASSERT_NE(MAP_FAILED, ptr);
+
+    pageFaultManager->insertAllocation(ptr, size, &unifiedMemoryManager, nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    auto &pageFaultData = pageFaultManager->memoryData.at(ptr);
+    ASSERT_EQ(4u, pageFaultData.chunks.size());
+
+    volatile uint8_t readValue = ptr[chunkSize];
+    EXPECT_EQ(0u, readValue);
+    ASSERT_EQ(1u, pageFaultManager->cpuTransfers.size());
+    EXPECT_EQ(ptr + chunkSize, pageFaultManager->cpuTransfers[0].first);
+    EXPECT_EQ(chunkSize, pageFaultManager->cpuTransfers[0].second);
+    EXPECT_EQ(MockChunkedPageFaultManagerLinux::ChunkState::cpuClean, pageFaultData.chunks[1]);
+
+    ptr[2 * chunkSize] = 5;
+    EXPECT_EQ(5u, ptr[2 * chunkSize]);
+    ASSERT_EQ(2u, pageFaultManager->cpuTransfers.size());
+    EXPECT_EQ(ptr + 2 * chunkSize, pageFaultManager->cpuTransfers[1].first);
+    EXPECT_EQ(MockChunkedPageFaultManagerLinux::ChunkState::cpuDirty, pageFaultData.chunks[2]);
+    EXPECT_EQ(MockChunkedPageFaultManagerLinux::ChunkState::gpu, pageFaultData.chunks[0]);
+    EXPECT_EQ(MockChunkedPageFaultManagerLinux::ChunkState::gpu, pageFaultData.chunks[3]);
+
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    ASSERT_EQ(1u, pageFaultManager->gpuTransfers.size());
+    EXPECT_EQ(ptr + 2 * chunkSize, pageFaultManager->gpuTransfers[0].first);
+    EXPECT_EQ(chunkSize, pageFaultManager->gpuTransfers[0].second);
+
+    pageFaultManager->removeAllocation(ptr);
+    ptr[0] = 1;
+    EXPECT_EQ(2u, pageFaultManager->cpuTransfers.size());
+
+    munmap(ptr, size);
+}
+
 class MockFailPageFaultManager : public PageFaultManagerLinux {
   public:
     using PageFaultManagerLinux::callPreviousHandler;
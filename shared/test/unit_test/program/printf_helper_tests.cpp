@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_kernel_info.h"
 
@@ -1018,3 +1019,85 @@ TEST(simpleSprintf, GivenEmptyFormatStringWhenSimpleSprintfIsCalledThenBailOutWi
     EXPECT_EQ(0, out[0]);
     EXPECT_EQ(0, out[1]);
 }
+
+struct MockPrintFormatter : public PrintFormatter {
+    using PrintFormatter::PrintFormatter;
+    using PrintFormatter::parsedFormatStrings;
+    using PrintFormatter::streamingBufferSize;
+};
+
+TEST_F(PrintFormatterTest, GivenFormatStringUsedByManyRecordsWhenPrintingThenFormatStringIsParsedOnce) {
+    auto mockPrintFormatter = new MockPrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit, &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap);
+    printFormatter.reset(mockPrintFormatter);
+    mockPrintFormatter->setStreamingBufferSize(0);
+
+    auto stringIndex = injectFormatString("%d\\n");
+    for (int i = 0; i < 4; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    std::vector<std::string> records;
+    printFormatter->printKernelOutput([&records](char *str) { records.push_back(str); });
+
+    ASSERT_EQ(4u, records.size());
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(std::to_string(i) + "\n", records[i]);
+    }
+    EXPECT_EQ(1u, mockPrintFormatter->parsedFormatStrings.size());
+}
+
+TEST_F(PrintFormatterTest, GivenFormatStringWithLiteralsAroundConversionsWhenPrintingThenLiteralsArePrintedInOrder) {
+    auto stringIndex = injectFormatString("a%d b%%%s c\\n");
+    storeData(stringIndex);
+    injectValue(7);
+    injectStringValue(injectFormatString("str"));
+
+    std::string output;
+    printFormatter->printKernelOutput([&output](char *str) { output += str; });
+
+    EXPECT_STREQ("a7 b%str c\n", output.c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenDefaultSettingsWhenCreatingPrintFormatterThenDefaultStreamingBufferSizeIsUsed) {
+    MockPrintFormatter mockPrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit);
+    EXPECT_EQ(PrintFormatter::defaultStreamingBufferSize, mockPrintFormatter.streamingBufferSize);
+}
+
+TEST_F(PrintFormatterTest, GivenPrintfStreamingBufferSizeDebugFlagWhenCreatingPrintFormatterThenStreamingBufferSizeIsOverridden) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.PrintfStreamingBufferSize.set(0);
+
+    MockPrintFormatter mockPrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit);
+    EXPECT_EQ(0u, mockPrintFormatter.streamingBufferSize);
+}
+
+TEST_F(PrintFormatterTest, GivenStreamingEnabledWhenPrintingManyRecordsThenOutputIsFlushedInBatches) {
+    auto stringIndex = injectFormatString("%d,");
+    for (int i = 0; i < 8; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    printFormatter->setStreamingBufferSize(8);
+    std::vector<std::string> chunks;
+    printFormatter->printKernelOutput([&chunks](char *str) { chunks.push_back(str); });
+
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ("0,1,2,3,", chunks[0]);
+    EXPECT_EQ("4,5,6,7,", chunks[1]);
+}
+
+TEST_F(PrintFormatterTest, GivenStreamingEnabledWhenPrintingRecordsBelowThresholdThenOutputIsFlushedOnceAtTheEnd) {
+    auto stringIndex = injectFormatString("%d,");
+    for (int i = 0; i < 3; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    std::vector<std::string> chunks;
+    printFormatter->printKernelOutput([&chunks](char *str) { chunks.push_back(str); });
+
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ("0,1,2,", chunks[0]);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/program/program_info.h"
 #include "shared/source/program/program_info_from_patchtokens.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 
 #include "RelocationInfo.h"
@@ -198,6 +199,48 @@ TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsThenKernelI
     EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[2]->kernelDescriptor.kernelAttributes.gpuPointerSize);
 }
 
+TEST(PopulateProgramInfoFromPatchtokensTests, GivenParallelKernelInfoPopulationWhenPopulatingProgramInfoThenKernelInfosAndLinkerInputKeepKernelOrder) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.ParallelPatchtokensKernelInfoPopulation.set(4);
+
+    NEO::ProgramInfo programInfo = {};
+    Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
+    programInfo.linkerInput.reset(mockLinkerInput);
+
+    PatchTokensTestData::ValidProgramWithKernel programFromTokens;
+    constexpr uint32_t kernelCount = 16u;
+    std::vector<std::string> kernelNames;
+    for (uint32_t i = 0; i < kernelCount; i++) {
+        kernelNames.push_back("kernel" + std::to_string(i));
+    }
+    for (uint32_t i = 1; i < kernelCount; i++) {
+        programFromTokens.kernels.push_back(programFromTokens.kernels[0]);
+    }
+    for (uint32_t i = 0; i < kernelCount; i++) {
+        programFromTokens.kernels[i].name = ArrayRef<const char>(kernelNames[i].c_str(), kernelNames[i].size() + 1);
+    }
+
+    iOpenCL::SPatchFunctionTableInfo symbolTable = {};
+    programFromTokens.kernels[3].tokens.programSymbolTable = &symbolTable;
+    programFromTokens.kernels[11].tokens.programSymbolTable = &symbolTable;
+
+    std::vector<uint32_t> receivedSegmentIds;
+    mockLinkerInput->decodeExportedFunctionsSymbolTableMockConfig.overrideFunc = [&](Mock<NEO::LinkerInput> *, const void *, uint32_t, uint32_t instructionsSegmentId) -> bool {
+        receivedSegmentIds.push_back(instructionsSegmentId);
+        return true;
+    };
+
+    NEO::populateProgramInfo(programInfo, programFromTokens);
+    ASSERT_EQ(kernelCount, programInfo.kernelInfos.size());
+    for (uint32_t i = 0; i < kernelCount; i++) {
+        EXPECT_EQ(kernelNames[i], programInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[i]->kernelDescriptor.kernelAttributes.gpuPointerSize);
+    }
+    ASSERT_EQ(2u, receivedSegmentIds.size());
+    EXPECT_EQ(3u, receivedSegmentIds[0]);
+    EXPECT_EQ(11u, receivedSegmentIds[1]);
+}
+
 TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsWhenKernelHasSymbolTableThenLinkerIsUpdatedWithAdditionalSymbolInfo) {
     NEO::ProgramInfo programInfo = {};
     Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
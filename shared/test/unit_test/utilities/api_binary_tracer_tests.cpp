@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_binary_tracer.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<ApiBinaryTraceRecord> getRecords(const std::string &trace) {
+    std::vector<ApiBinaryTraceRecord> records((trace.size() - sizeof(ApiBinaryTraceFileHeader)) / sizeof(ApiBinaryTraceRecord));
+    memcpy(records.data(), trace.data() + sizeof(ApiBinaryTraceFileHeader), records.size() * sizeof(ApiBinaryTraceRecord));
+    return records;
+}
+} // namespace
+
+TEST(ApiBinaryTracerTest, givenRecordsWhenTracerIsDestroyedThenHeaderAndAllRecordsAreWritten) {
+    std::stringstream output;
+    {
+        ApiBinaryTracer tracer(output);
+        tracer.record(1u, 0x1000u, 10u, 20u, 0);
+        tracer.record(2u, 0x2000u, 30u, 40u, -5);
+    }
+
+    auto trace = output.str();
+    ASSERT_EQ(sizeof(ApiBinaryTraceFileHeader) + 2 * sizeof(ApiBinaryTraceRecord), trace.size());
+
+    ApiBinaryTraceFileHeader header = {};
+    memcpy(&header, trace.data(), sizeof(header));
+    EXPECT_EQ(ApiBinaryTraceFileHeader::magicValue, header.magic);
+    EXPECT_EQ(ApiBinaryTraceFileHeader::currentVersion, header.version);
+    EXPECT_EQ(sizeof(ApiBinaryTraceRecord), header.recordSize);
+
+    auto records = getRecords(trace);
+    EXPECT_EQ(1u, records[0].apiId);
+    EXPECT_EQ(0x1000u, records[0].handle);
+    EXPECT_EQ(10u, records[0].startTimestamp);
+    EXPECT_EQ(20u, records[0].endTimestamp);
+    EXPECT_EQ(0, records[0].result);
+    EXPECT_EQ(2u, records[1].apiId);
+    EXPECT_EQ(-5, records[1].result);
+    EXPECT_EQ(records[0].threadId, records[1].threadId);
+    EXPECT_EQ(records[0].correlationId + 1, records[1].correlationId);
+}
+
+TEST(ApiBinaryTracerTest, givenRecordsFromManyThreadsWhenTracerIsDestroyedThenRecordsOfEveryThreadAreWrittenWithUniqueCorrelationIds) {
+    constexpr uint32_t threadCount = 4;
+    constexpr uint64_t recordsPerThread = ApiBinaryTracer::recordsPerThreadBuffer + 10;
+
+    std::stringstream output;
+    {
+        ApiBinaryTracer tracer(output);
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadCount; i++) {
+            threads.emplace_back([&tracer, i]() {
+                for (uint64_t j = 0; j < recordsPerThread; j++) {
+                    tracer.record(i, j, j, j, 0);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    auto records = getRecords(output.str());
+    ASSERT_EQ(threadCount * recordsPerThread, records.size());
+
+    std::vector<uint64_t> recordCounts(threadCount, 0u);
+    std::vector<uint64_t> correlationIds;
+    for (auto &record : records) {
+        ASSERT_LT(record.apiId, threadCount);
+        recordCounts[record.apiId]++;
+        correlationIds.push_back(record.correlationId);
+    }
+    for (auto count : recordCounts) {
+        EXPECT_EQ(recordsPerThread, count);
+    }
+    std::sort(correlationIds.begin(), correlationIds.end());
+    EXPECT_EQ(correlationIds.end(), std::adjacent_find(correlationIds.begin(), correlationIds.end()));
+}
+
+TEST(ApiBinaryTracerTest, givenThreadExitingWhileTracerIsDestroyedWhenTraceIsReadThenRecordOfThatThreadIsWrittenOnce) {
+    std::stringstream output;
+    auto tracer = std::make_unique<ApiBinaryTracer>(output);
+    std::atomic<bool> recorded{false};
+    std::atomic<bool> exitThread{false};
+
+    std::thread thread([&]() {
+        tracer->record(1u, 0u, 0u, 0u, 0);
+        recorded = true;
+        while (!exitThread) {
+            std::this_thread::yield();
+        }
+    });
+    while (!recorded) {
+        std::this_thread::yield();
+    }
+
+    exitThread = true;
+    tracer.reset();
+    thread.join();
+
+    auto records = getRecords(output.str());
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(1u, records[0].apiId);
+}
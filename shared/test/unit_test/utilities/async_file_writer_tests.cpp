@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockAsyncFileWriter : public AsyncFileWriter {
+    using AsyncFileWriter::AsyncFileWriter;
+    using AsyncFileWriter::currentBlock;
+    using AsyncFileWriter::freeBlocks;
+};
+
+TEST(AsyncFileWriterTest, givenDataSmallerThanBlockWhenWritingThenDataIsKeptUntilFlushOrDrain) {
+    std::stringstream output;
+    MockAsyncFileWriter writer(output, 16u, 2u);
+
+    writer.write("abc", 3u);
+    EXPECT_EQ(3u, writer.currentBlock.size());
+
+    writer.drain();
+    EXPECT_TRUE(writer.currentBlock.empty());
+    EXPECT_EQ("abc", output.str());
+}
+
+TEST(AsyncFileWriterTest, givenDataSpanningManyBlocksWhenDrainingThenOutputContainsAllDataInWriteOrder) {
+    std::stringstream output;
+    std::string expected;
+    {
+        MockAsyncFileWriter writer(output, 7u, 2u);
+        for (int i = 0; i < 100; i++) {
+            auto chunk = std::to_string(i) + ";";
+            expected += chunk;
+            writer.write(chunk.c_str(), chunk.size());
+        }
+        writer.drain();
+        EXPECT_EQ(expected, output.str());
+        EXPECT_FALSE(writer.freeBlocks.empty());
+    }
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(AsyncFileWriterTest, givenFlushCalledWhenWriterIsDestroyedThenAllDataIsWritten) {
+    std::stringstream output;
+    {
+        MockAsyncFileWriter writer(output, 1024u, 1u);
+        writer.write("first", 5u);
+        writer.flush();
+        EXPECT_TRUE(writer.currentBlock.empty());
+        writer.write("second", 6u);
+    }
+    EXPECT_EQ("firstsecond", output.str());
+}
+
+TEST(AsyncFileWriterTest, givenManyThreadsWritingWholeRecordsWhenDrainingThenEveryRecordIsWrittenUnsplit) {
+    std::stringstream output;
+    constexpr size_t numThreads = 4u;
+    constexpr size_t recordsPerThread = 64u;
+    constexpr size_t recordSize = 10u;
+    {
+        MockAsyncFileWriter writer(output, 32u, 2u);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < numThreads; t++) {
+            threads.emplace_back([&writer, t]() {
+                std::string record(recordSize, static_cast<char>('a' + t));
+                for (size_t i = 0; i < recordsPerThread; i++) {
+                    writer.write(record.c_str(), record.size());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    auto result = output.str();
+    ASSERT_EQ(numThreads * recordsPerThread * recordSize, result.size());
+    for (size_t offset = 0; offset < result.size(); offset += recordSize) {
+        EXPECT_EQ(std::string(recordSize, result[offset]), result.substr(offset, recordSize));
+    }
+}
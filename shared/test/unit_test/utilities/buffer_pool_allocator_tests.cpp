@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,7 +62,11 @@ struct DummyBuffersAllocator : public NEO::AbstractBuffersAllocator<DummyBuffers
     using BaseType = NEO::AbstractBuffersAllocator<DummyBuffersPool, DummyBuffer>;
     using BaseType::addNewBufferPool;
     using BaseType::bufferPools;
+    using BaseType::drainOnFree;
+    using BaseType::drainPoolTier;
+    using BaseType::getPoolTierIndex;
     using BaseType::isSizeWithinThreshold;
+    using BaseType::registerPoolTierAllocation;
 
     void drainUnderLock() {
         auto lock = std::unique_lock<std::mutex>(this->mutex);
@@ -316,3 +320,120 @@ TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWhenDrainingPoolThenOffset
         EXPECT_EQ(heapAllocator->registeredOffsets[i], exampleOffsets[i] + DummyBuffersPool::startingOffset);
     }
 }
+
+TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWithDefaultTiersWhenGettingTierIndexThenOnlySmallBuffersAreServed) {
+    auto buffersAllocator = DummyBuffersAllocator{};
+    ASSERT_EQ(1u, buffersAllocator.getPoolTiers().size());
+    EXPECT_EQ(DummyBuffersPool::smallBufferThreshold, buffersAllocator.getPoolTiers()[0].maxBufferSize);
+    EXPECT_EQ(DummyBuffersPool::aggregatedSmallBuffersPoolSize, buffersAllocator.getPoolTiers()[0].poolSize);
+
+    EXPECT_EQ(0u, buffersAllocator.getPoolTierIndex(1u));
+    EXPECT_EQ(0u, buffersAllocator.getPoolTierIndex(DummyBuffersPool::smallBufferThreshold));
+    EXPECT_EQ(1u, buffersAllocator.getPoolTierIndex(DummyBuffersPool::smallBufferThreshold + 1));
+}
+
+TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWithMultipleTiersWhenGettingTierIndexThenSmallestFittingTierIsReturned) {
+    auto buffersAllocator = DummyBuffersAllocator{};
+    buffersAllocator.setPoolTiers({{DummyBuffersPool::smallBufferThreshold, DummyBuffersPool::aggregatedSmallBuffersPoolSize},
+                                   {4 * DummyBuffersPool::smallBufferThreshold, 4 * DummyBuffersPool::aggregatedSmallBuffersPoolSize}});
+    ASSERT_EQ(2u, buffersAllocator.getPoolTiers().size());
+
+    EXPECT_EQ(0u, buffersAllocator.getPoolTierIndex(DummyBuffersPool::smallBufferThreshold));
+    EXPECT_EQ(1u, buffersAllocator.getPoolTierIndex(DummyBuffersPool::smallBufferThreshold + 1));
+    EXPECT_EQ(1u, buffersAllocator.getPoolTierIndex(4 * DummyBuffersPool::smallBufferThreshold));
+    EXPECT_EQ(2u, buffersAllocator.getPoolTierIndex(4 * DummyBuffersPool::smallBufferThreshold + 1));
+
+    EXPECT_TRUE(buffersAllocator.isSizeWithinThreshold(4 * DummyBuffersPool::smallBufferThreshold));
+    EXPECT_FALSE(buffersAllocator.isSizeWithinThreshold(4 * DummyBuffersPool::smallBufferThreshold + 1));
+}
+
+TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWhenRegisteringTierAllocationsThenHitsAndMissesAreCountedPerTier) {
+    auto buffersAllocator = DummyBuffersAllocator{};
+    buffersAllocator.setPoolTiers({{DummyBuffersPool::smallBufferThreshold, DummyBuffersPool::aggregatedSmallBuffersPoolSize},
+                                   {4 * DummyBuffersPool::smallBufferThreshold, 4 * DummyBuffersPool::aggregatedSmallBuffersPoolSize}});
+
+    buffersAllocator.registerPoolTierAllocation(0u, true);
+    buffersAllocator.registerPoolTierAllocation(0u, true);
+    buffersAllocator.registerPoolTierAllocation(1u, false);
+
+    auto statistics0 = buffersAllocator.getPoolTierStatistics(0u);
+    auto statistics1 = buffersAllocator.getPoolTierStatistics(1u);
+    auto statistics2 = buffersAllocator.getPoolTierStatistics(2u);
+    EXPECT_EQ(2u, statistics0.poolHits);
+    EXPECT_EQ(0u, statistics0.poolMisses);
+    EXPECT_EQ(0u, statistics1.poolHits);
+    EXPECT_EQ(1u, statistics1.poolMisses);
+    EXPECT_EQ(0u, statistics2.poolHits);
+    EXPECT_EQ(0u, statistics2.poolMisses);
+
+    buffersAllocator.setPoolTiers({{DummyBuffersPool::smallBufferThreshold, DummyBuffersPool::aggregatedSmallBuffersPoolSize}});
+    EXPECT_EQ(0u, buffersAllocator.getPoolTierStatistics(0u).poolHits);
+}
+
+TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWithPoolsInDifferentTiersWhenDrainingTierThenOnlyPoolsFromThisTierAreDrained) {
+    auto pool1 = DummyBuffersPool{this->memoryManager.get()};
+    auto pool2 = DummyBuffersPool{this->memoryManager.get()};
+    pool1.mainStorage.reset(new DummyBuffer(testVal));
+    pool2.mainStorage.reset(new DummyBuffer(testVal + 2));
+    pool2.tierIndex = 1u;
+    auto buffer1 = pool1.mainStorage.get();
+    auto buffer2 = pool2.mainStorage.get();
+    for (auto pool : {&pool1, &pool2}) {
+        pool->chunkAllocator.reset(new NEO::HeapAllocator{DummyBuffersPool::startingOffset,
+                                                          DummyBuffersPool::aggregatedSmallBuffersPoolSize,
+                                                          DummyBuffersPool::chunkAlignment,
+                                                          DummyBuffersPool::smallBufferThreshold});
+    }
+
+    auto buffersAllocator = DummyBuffersAllocator{};
+    buffersAllocator.addNewBufferPool(std::move(pool1));
+    buffersAllocator.addNewBufferPool(std::move(pool2));
+    EXPECT_EQ(1u, buffersAllocator.bufferPools[1].tierIndex);
+
+    auto chunkSize = DummyBuffersPool::chunkAlignment * 4;
+    auto chunkOffset = DummyBuffersPool::chunkAlignment;
+    buffersAllocator.tryFreeFromPoolBuffer(buffer1, chunkOffset, chunkSize);
+    buffersAllocator.tryFreeFromPoolBuffer(buffer2, chunkOffset, chunkSize);
+
+    buffersAllocator.drainPoolTier(1u);
+    EXPECT_EQ(1u, buffersAllocator.bufferPools[0].chunksToFree.size());
+    EXPECT_EQ(0u, buffersAllocator.bufferPools[1].chunksToFree.size());
+    EXPECT_EQ(1u, buffersAllocator.bufferPools[1].freedChunks.size());
+}
+
+TEST_F(AbstractSmallBuffersTest, givenBuffersAllocatorWithDrainOnFreeWhenChunkIsFreedThenOnlyPoolOwningTheChunkIsDrained) {
+    auto otherMemoryManager = std::make_unique<MockMemoryManager>(this->executionEnvironment);
+
+    auto pool1 = DummyBuffersPool{this->memoryManager.get()};
+    auto pool2 = DummyBuffersPool{otherMemoryManager.get()};
+    pool1.mainStorage.reset(new DummyBuffer(testVal));
+    pool2.mainStorage.reset(new DummyBuffer(testVal + 2));
+    auto buffer1 = pool1.mainStorage.get();
+    auto buffer2 = pool2.mainStorage.get();
+    for (auto pool : {&pool1, &pool2}) {
+        pool->chunkAllocator.reset(new NEO::HeapAllocator{DummyBuffersPool::startingOffset,
+                                                          DummyBuffersPool::aggregatedSmallBuffersPoolSize,
+                                                          DummyBuffersPool::chunkAlignment,
+                                                          DummyBuffersPool::smallBufferThreshold});
+    }
+
+    auto buffersAllocator = DummyBuffersAllocator{};
+    buffersAllocator.drainOnFree = true;
+    buffersAllocator.addNewBufferPool(std::move(pool1));
+    buffersAllocator.addNewBufferPool(std::move(pool2));
+
+    auto chunkSize = DummyBuffersPool::chunkAlignment * 4;
+    auto chunkOffset = DummyBuffersPool::chunkAlignment;
+    otherMemoryManager->deferAllocInUse = true;
+    buffersAllocator.tryFreeFromPoolBuffer(buffer1, chunkOffset, chunkSize);
+    EXPECT_EQ(1u, this->memoryManager->allocInUseCalled);
+    EXPECT_EQ(0u, otherMemoryManager->allocInUseCalled);
+    EXPECT_EQ(0u, buffersAllocator.bufferPools[0].chunksToFree.size());
+    EXPECT_EQ(1u, buffersAllocator.bufferPools[0].freedChunks.size());
+
+    buffersAllocator.tryFreeFromPoolBuffer(buffer2, chunkOffset, chunkSize);
+    EXPECT_EQ(1u, this->memoryManager->allocInUseCalled);
+    EXPECT_EQ(1u, otherMemoryManager->allocInUseCalled);
+    EXPECT_EQ(1u, buffersAllocator.bufferPools[1].chunksToFree.size());
+    EXPECT_EQ(0u, buffersAllocator.bufferPools[1].freedChunks.size());
+}
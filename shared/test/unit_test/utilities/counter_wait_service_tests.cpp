@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/counter_wait_service.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockCounterWaitService : public CounterWaitService {
+    using CounterWaitService::serviceThread;
+    using CounterWaitService::Waiter;
+    using CounterWaitService::signalCompletedWaiters;
+    using CounterWaitService::waiters;
+};
+
+struct BlockingCounterWaitService : public MockCounterWaitService {
+    void waitForCounterChange(volatile const uint64_t *address, uint64_t targetValue, uint32_t idleIterations) override {
+        counterWaitEntered = true;
+        while (!counterWaitReleased) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic_bool counterWaitEntered = false;
+    std::atomic_bool counterWaitReleased = false;
+};
+
+TEST(CounterWaitServiceTest, givenCounterAlreadyReachedWhenWaitingForValueThenReturnTrueWithoutStartingServiceThread) {
+    MockCounterWaitService counterWaitService;
+    volatile uint64_t counter = 5u;
+
+    EXPECT_TRUE(counterWaitService.waitForValue(&counter, 5u, std::chrono::microseconds(0)));
+    EXPECT_TRUE(counterWaitService.waitForValue(&counter, 3u, std::chrono::microseconds(0)));
+    EXPECT_EQ(nullptr, counterWaitService.serviceThread.get());
+}
+
+TEST(CounterWaitServiceTest, givenCounterNotReachedWhenWaitTimesOutThenReturnFalseAndUnregisterWaiter) {
+    MockCounterWaitService counterWaitService;
+    volatile uint64_t counter = 1u;
+
+    EXPECT_FALSE(counterWaitService.waitForValue(&counter, 2u, std::chrono::microseconds(100)));
+    EXPECT_NE(nullptr, counterWaitService.serviceThread.get());
+    EXPECT_TRUE(counterWaitService.waiters.empty());
+}
+
+TEST(CounterWaitServiceTest, givenCounterUpdatedByAnotherThreadWhenWaitingForValueThenWaiterIsWokenUp) {
+    MockCounterWaitService counterWaitService;
+    volatile uint64_t counter = 0u;
+
+    std::thread signalingThread([&counter]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        counter = 10u;
+    });
+
+    EXPECT_TRUE(counterWaitService.waitForValue(&counter, 10u, std::chrono::seconds(60)));
+    signalingThread.join();
+    EXPECT_TRUE(counterWaitService.waiters.empty());
+}
+
+TEST(CounterWaitServiceTest, givenWaitersWithDifferentTargetsWhenSignalingCompletedWaitersThenOnlyReachedWaitersAreSignaledAndLowestPendingTargetIsReturned) {
+    MockCounterWaitService counterWaitService;
+    volatile uint64_t counter = 5u;
+
+    MockCounterWaitService::Waiter reachedWaiter;
+    reachedWaiter.address = &counter;
+    reachedWaiter.targetValue = 4u;
+    MockCounterWaitService::Waiter farWaiter;
+    farWaiter.address = &counter;
+    farWaiter.targetValue = 9u;
+    MockCounterWaitService::Waiter nearWaiter;
+    nearWaiter.address = &counter;
+    nearWaiter.targetValue = 7u;
+
+    counterWaitService.waiters = {&reachedWaiter, &farWaiter, &nearWaiter};
+
+    EXPECT_EQ(&nearWaiter, counterWaitService.signalCompletedWaiters());
+    EXPECT_TRUE(reachedWaiter.signaled);
+    EXPECT_FALSE(farWaiter.signaled);
+    EXPECT_FALSE(nearWaiter.signaled);
+
+    counter = 9u;
+    EXPECT_EQ(nullptr, counterWaitService.signalCompletedWaiters());
+    EXPECT_TRUE(farWaiter.signaled);
+    EXPECT_TRUE(nearWaiter.signaled);
+
+    counterWaitService.waiters.clear();
+}
+
+TEST(CounterWaitServiceTest, givenManyHostThreadsWaitingOnSeparateCountersWhenCountersAreSignaledThenAllWaitersAreWokenUp) {
+    MockCounterWaitService counterWaitService;
+    constexpr uint32_t numWaiters = 8u;
+    volatile uint64_t counters[numWaiters] = {};
+    bool results[numWaiters] = {};
+
+    std::vector<std::thread> waitingThreads;
+    for (uint32_t i = 0; i < numWaiters; i++) {
+        waitingThreads.emplace_back([&, i]() {
+            results[i] = counterWaitService.waitForValue(&counters[i], i + 1, std::chrono::seconds(60));
+        });
+    }
+
+    for (uint32_t i = 0; i < numWaiters; i++) {
+        counters[i] = i + 1;
+    }
+    for (auto &thread : waitingThreads) {
+        thread.join();
+    }
+
+    for (uint32_t i = 0; i < numWaiters; i++) {
+        EXPECT_TRUE(results[i]);
+    }
+    EXPECT_TRUE(counterWaitService.waiters.empty());
+}
+
+TEST(CounterWaitServiceTest, givenServiceThreadWaitingForCounterChangeWhenAnotherWaiterRegistersThenItIsNotBlockedByServiceThread) {
+    BlockingCounterWaitService counterWaitService;
+    volatile uint64_t monitoredCounter = 0u;
+    volatile uint64_t otherCounter = 0u;
+
+    bool monitoredResult = false;
+    std::thread waitingThread([&]() {
+        monitoredResult = counterWaitService.waitForValue(&monitoredCounter, 1u, std::chrono::seconds(60));
+    });
+    while (!counterWaitService.counterWaitEntered) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(counterWaitService.waitForValue(&otherCounter, 1u, std::chrono::microseconds(100)));
+
+    monitoredCounter = 1u;
+    counterWaitService.counterWaitReleased = true;
+    waitingThread.join();
+    EXPECT_TRUE(monitoredResult);
+    EXPECT_TRUE(counterWaitService.waiters.empty());
+}
+
+TEST(CounterWaitServiceTest, givenMonitoredWaiterTimedOutWhenServiceThreadStillWaitsForItsCounterThenWaiterIsUnregisteredAfterWaitFinishes) {
+    BlockingCounterWaitService counterWaitService;
+    volatile uint64_t counter = 0u;
+
+    std::atomic_bool waitFinished = false;
+    std::thread waitingThread([&]() {
+        EXPECT_FALSE(counterWaitService.waitForValue(&counter, 1u, std::chrono::microseconds(100)));
+        waitFinished = true;
+    });
+    while (!counterWaitService.counterWaitEntered) {
+        std::this_thread::yield();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(waitFinished);
+
+    counterWaitService.counterWaitReleased = true;
+    waitingThread.join();
+    EXPECT_TRUE(waitFinished);
+    EXPECT_TRUE(counterWaitService.waiters.empty());
+}